@@ -0,0 +1,109 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// 1 KB upload buffer: ~128 raw samples, several hundred compressed
+TimeSeriesEncoder<1024> uploadBuffer;
+
+// Simulated temperature sensor: 0.0625 °C resolution, read every 100 ms
+IO<TimedSample> readTemperature() {
+  return IO<TimedSample>([]() {
+    static uint32_t now = 0;
+    static int raw = 20 * 16;
+    now += 100;
+    raw += random(-1, 2) * (random(0, 4) == 0 ? 1 : 0);  // Slow random walk
+    return TimedSample{now, raw / 16.0f};
+  });
+}
+
+// expected output: Stored ... samples in 1024 bytes (ratio ~20), last: t=... value=...
+void testUploadBuffer() {
+  uploadBuffer.clear();
+  bool full = false;
+  while (!full) {
+    readTemperature()
+      .map(stage(uploadBuffer))
+      .run()
+      .match(
+        [&](CompressionError) { full = true; },
+        [](TimedSample) {}
+      );
+  }
+  Serial.println("Stored " + String((unsigned long)uploadBuffer.count()) + " samples in "
+                 + String((unsigned long)uploadBuffer.sizeBytes()) + " bytes (ratio "
+                 + String(uploadBuffer.compressionRatio()) + ")");
+
+  // Decode in place, e.g. while sending
+  TimedSample last{0, 0.0f};
+  uploadBuffer.decoder().forEach([&](TimedSample s) { last = s; });
+  Serial.println("  last: t=" + String((unsigned long)last.timestamp) + " value=" + String(last.value));
+}
+
+// =========== Benchmark: compression ratio and throughput per trace ===========
+
+template<typename Gen>
+void benchmarkTrace(const char* name, Gen gen) {
+  const size_t n = 20000;
+  std::vector<TimedSample> trace(n);
+  for (size_t i = 0; i < n; ++i) trace[i] = gen(i);
+
+  static TimeSeriesEncoder<n * sizeof(TimedSample) + 64> encoder;  // Big enough for the worst case
+  encoder.clear();
+  unsigned long start = micros();
+  for (const TimedSample& s : trace) encoder(s);
+  unsigned long encodeTime = micros() - start;
+
+  volatile float sink = 0;
+  start = micros();
+  encoder.decoder().forEach([&](TimedSample s) { sink = sink + s.value; });
+  unsigned long decodeTime = micros() - start;
+
+  const float megabytes = n * sizeof(TimedSample) / 1e6f;
+  Serial.println(String("  ") + name + ": ratio " + String(encoder.compressionRatio(), 2)
+                 + " (" + String(encoder.sizeBits() / float(n), 1) + " bits/sample), encode "
+                 + String(megabytes / (encodeTime ? encodeTime : 1) * 1e6f, 1) + " MB/s, decode "
+                 + String(megabytes / (decodeTime ? decodeTime : 1) * 1e6f, 1) + " MB/s");
+}
+
+void benchmarkCompression() {
+  Serial.println("Compression (20000 samples, 8 raw bytes each):");
+
+  // Quantized temperature, fixed period: most values repeat
+  benchmarkTrace("temperature 1/16 C @ 100 ms", [](size_t i) {
+    return TimedSample{uint32_t(i * 100), int(20 * 16 + 8 * sin(i / 500.0)) / 16.0f};
+  });
+
+  // 12-bit ADC counts with noise, period jitter of +-1 ms
+  benchmarkTrace("ADC counts + noise, jitter", [](size_t i) {
+    return TimedSample{uint32_t(i * 10 + random(-1, 2)), float(2048 + (int)random(-8, 9))};
+  });
+
+  // Smooth float signal: every sample changes the mantissa
+  benchmarkTrace("smooth float (sine)", [](size_t i) {
+    return TimedSample{uint32_t(i * 20), float(3.3 * sin(i / 100.0))};
+  });
+
+  // Worst case: random floats, irregular timestamps
+  benchmarkTrace("random floats, irregular", [](size_t i) {
+    return TimedSample{uint32_t(i * 1000 + random(0, 900)), random(0, 1000000) / 7.0f};
+  });
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testUploadBuffer();
+  benchmarkCompression();
+
+  delay(1000);
+}
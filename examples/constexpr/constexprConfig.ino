@@ -0,0 +1,123 @@
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// =========== Compile-time checks (this sketch does not compile if one fails) ===========
+
+static_assert(Maybe<int>::Just(2).isJust(), "Just is Just");
+static_assert(Maybe<int>::Nothing().isNothing(), "Nothing is Nothing");
+static_assert(Maybe<int>::Just(2)
+                .map([](int x) { return x * 21; })
+                .fold([](int x) { return x; }, []() { return 0; }) == 42, "map + fold");
+static_assert(Maybe<int>::Nothing()
+                .flatMap([](int x) { return Maybe<int>::Just(x); })
+                .isNothing(), "flatMap on Nothing");
+static_assert(Either<int, int>::Right(20)
+                .flatMap([](int x) { return Either<int, int>::Right(x + 1); })
+                .unwrapRight() == 21, "Either flatMap");
+static_assert(Either<int, int>::Left(3)
+                .map([](int x) { return x + 1; })
+                .mapLeft([](int e) { return e * 2; })
+                .match([](int e) { return e; }, [](int) { return -1; }) == 6, "Either map on Left");
+
+// =========== Calibration table, validated at compile time ===========
+
+enum class CalibrationError { GainIsZero, EmptyRange };
+
+struct Calibration {
+  float gain;
+  float offset;
+  int minRaw;
+  int maxRaw;
+};
+
+const size_t CHANNELS = 8;
+
+constexpr Calibration RAW_CALIBRATION[CHANNELS] = {
+  {1.00f,  0.0f, 0, 4095},
+  {0.50f, -2.0f, 0, 4095},
+  {2.00f,  1.5f, 100, 4000},
+  {0.00f,  0.0f, 0, 4095},   // invalid: gain 0
+  {1.20f,  0.3f, 0, 1023},
+  {1.00f,  0.0f, 500, 500},  // invalid: empty range
+  {0.80f,  0.1f, 0, 4095},
+  {1.10f, -0.4f, 0, 4095},
+};
+
+constexpr Calibration DEFAULT_CALIBRATION = {1.0f, 0.0f, 0, 4095};
+
+constexpr Either<Calibration, CalibrationError> validateCalibration(Calibration c) {
+  if (c.gain == 0.0f) return Either<Calibration, CalibrationError>::Left(CalibrationError::GainIsZero);
+  if (c.minRaw >= c.maxRaw) return Either<Calibration, CalibrationError>::Left(CalibrationError::EmptyRange);
+  return Either<Calibration, CalibrationError>::Right(c);
+}
+
+struct CalibrationTable {
+  Calibration channels[CHANNELS];
+};
+
+// Invalid entries fall back to the default calibration
+constexpr CalibrationTable buildCalibrationTable(const Calibration (&raw)[CHANNELS]) {
+  CalibrationTable table = {};
+  for (size_t i = 0; i < CHANNELS; ++i) {
+    table.channels[i] = validateCalibration(raw[i]).fold(
+      [](CalibrationError) { return DEFAULT_CALIBRATION; },
+      [](Calibration c) { return c; }
+    );
+  }
+  return table;
+}
+
+// Computed by the compiler and placed in flash (.rodata), nothing runs at startup
+constexpr CalibrationTable CALIBRATION = buildCalibrationTable(RAW_CALIBRATION);
+
+static_assert(CALIBRATION.channels[2].gain == 2.0f, "valid entry is kept");
+static_assert(CALIBRATION.channels[3].gain == 1.0f, "gain 0 falls back to default");
+static_assert(CALIBRATION.channels[5].maxRaw == 4095, "empty range falls back to default");
+static_assert(validateCalibration(RAW_CALIBRATION[3])
+                .fold([](CalibrationError e) { return e == CalibrationError::GainIsZero; },
+                      [](Calibration) { return false; }), "reports the right error");
+
+// For comparison: the same table built at runtime into RAM
+CalibrationTable runtimeCalibration;
+
+float applyCalibration(const Calibration& c, int raw) {
+  return c.gain * raw + c.offset;
+}
+
+// expected output: channel 2, raw 1000: 2001.50; startup/RAM comparison
+void testConstexprConfig() {
+  Serial.println("channel 2, raw 1000: " + String(applyCalibration(CALIBRATION.channels[2], 1000)));
+
+  // Runtime build (what used to happen before setup() / in setup())
+  Calibration raw[CHANNELS];
+  for (size_t i = 0; i < CHANNELS; ++i) {
+    raw[i] = RAW_CALIBRATION[i];
+    raw[i].offset += (float)random(0, 1);  // keep the compiler from folding it
+  }
+  unsigned long start = micros();
+  runtimeCalibration = buildCalibrationTable(raw);
+  unsigned long runtimeBuild = micros() - start;
+
+  Serial.println("Calibration table (" + String((unsigned long)sizeof(CalibrationTable)) + " bytes):");
+  Serial.println("  constexpr: 0 us at startup, 0 bytes RAM (flash)");
+  Serial.println("  runtime:   " + String(runtimeBuild) + " us at startup, "
+                 + String((unsigned long)sizeof(runtimeCalibration)) + " bytes RAM");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testConstexprConfig();
+
+  delay(1000);
+}
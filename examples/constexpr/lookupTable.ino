@@ -0,0 +1,87 @@
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Pure calibration curve: ADC voltage -> temperature (°C), NTC-like rational fit
+constexpr float voltageToCelsius(float v) {
+  return 1.0f / (0.0033f + 0.00025f * v + 0.00002f * v * v * v) - 273.15f + 0.5f * v;
+}
+
+// Sampled at compile time into flash
+constexpr auto CELSIUS_CURVE = makeLookupTable<128>(voltageToCelsius, 0.0f, 3.3f);
+
+static_assert(CELSIUS_CURVE(0.0f) == voltageToCelsius(0.0f), "exact at the first point");
+static_assert(CELSIUS_CURVE(3.3f) == voltageToCelsius(3.3f), "exact at the last point");
+static_assert(CELSIUS_CURVE(-1.0f) == CELSIUS_CURVE(0.0f), "clamped below the domain");
+
+// Simulated ADC read
+IO<float> readVoltage() {
+  return IO<float>([]() { return random(0, 4096) * 3.3f / 4095.0f; });
+}
+
+// expected output: Temperature: ... °C (same as with voltageToCelsius)
+void testLookupStage() {
+  // Drop-in replacement for .map(voltageToCelsius)
+  float celsius = readVoltage().map(lookup(CELSIUS_CURVE)).run();
+  Serial.println("Temperature: " + String(celsius) + " C");
+
+  Maybe<float>::Just(1.65f).map(lookup(CELSIUS_CURVE)).match(
+    [](float c) { Serial.println("Maybe 1.65 V -> " + String(c) + " C"); },
+    []() { Serial.println("Nothing"); }
+  );
+}
+
+// Accuracy: max |table - f| over a dense sweep of the domain
+void testLookupAccuracy() {
+  float maxError = 0;
+  for (int i = 0; i <= 10000; ++i) {
+    float v = 3.3f * i / 10000.0f;
+    float error = fabs(CELSIUS_CURVE(v) - voltageToCelsius(v));
+    if (error > maxError) maxError = error;
+  }
+  Serial.println("Max interpolation error (128 points): " + String(maxError, 4) + " C");
+}
+
+// Benchmark: ns/sample, direct function vs. table
+void benchmarkLookup() {
+  const long samples = 200000;
+  volatile float sink = 0;
+  float v = 0;
+
+  unsigned long start = micros();
+  for (long i = 0; i < samples; ++i) {
+    v = (i & 4095) * (3.3f / 4095.0f);
+    sink = sink + voltageToCelsius(v);
+  }
+  unsigned long directTime = micros() - start;
+
+  start = micros();
+  for (long i = 0; i < samples; ++i) {
+    v = (i & 4095) * (3.3f / 4095.0f);
+    sink = sink + CELSIUS_CURVE(v);
+  }
+  unsigned long tableTime = micros() - start;
+
+  Serial.println("direct: " + String(directTime * 1000.0f / samples, 2) + " ns/sample, table: "
+                 + String(tableTime * 1000.0f / samples, 2) + " ns/sample, table size: "
+                 + String((unsigned long)sizeof(CELSIUS_CURVE)) + " bytes (flash)");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testLookupStage();
+  testLookupAccuracy();
+  benchmarkLookup();
+
+  delay(1000);
+}
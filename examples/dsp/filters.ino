@@ -0,0 +1,104 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Filter state lives here, not in globals scattered over map lambdas
+MedianFilter<float, 5> despike;
+MovingAverage<float, 16> average;
+Ema<float> smooth(0.2f);
+Biquad<float> lowPass = Biquad<float>::lowPass(100.0f, 5.0f);  // 100 Hz sampling, 5 Hz cutoff
+
+// Simulated noisy sensor with occasional spikes
+IO<float> readSensor() {
+  return IO<float>([]() {
+    float noise = random(-100, 100) / 100.0f;
+    float spike = (random(0, 50) == 0) ? 50.0f : 0.0f;
+    return 20.0f + noise + spike;
+  });
+}
+
+// Every run() pushes one sample through all filters, the state stays in the globals above
+float readFiltered() {
+  return readSensor()
+    .map(stage(despike))
+    .map(stage(average))
+    .map(stage(smooth))
+    .map(stage(lowPass))
+    .run();
+}
+
+// expected output: Filtered: ~20.00 (spikes removed)
+void testFilterPipeline() {
+  float value = 0;
+  for (int i = 0; i < 100; ++i) value = readFiltered();
+  Serial.println("Filtered: " + String(value));
+}
+
+// A NaN reading is treated like a spike and leaves the window again
+// expected output: Median with NaN: 20.00 20.00 20.00 21.00 21.00 21.00 21.00 21.00
+void testMedianNaN() {
+  MedianFilter<float, 3> median;
+  const float in[] = {20.0f, 20.0f, NAN, 21.0f, 21.0f, 21.0f, 21.0f, 21.0f};
+  String line = "Median with NaN:";
+  for (float x : in) line += " " + String(median(x));
+  Serial.println(line);
+}
+
+// Benchmark: Msamples/s per operator, per-sample call vs. block processing
+template<typename Filter>
+void benchmarkFilter(const char* name, Filter filter, const std::vector<float>& in) {
+  std::vector<float> out(in.size());
+  const int rounds = 50;
+  volatile float sink = 0;
+
+  Filter perSample = filter;
+  unsigned long start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    for (size_t i = 0; i < in.size(); ++i) out[i] = perSample(in[i]);
+    sink = sink + out[in.size() - 1];
+  }
+  unsigned long perSampleTime = micros() - start;
+
+  Filter block = filter;
+  start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    block.process(in.data(), out.data(), in.size());
+    sink = sink + out[in.size() - 1];
+  }
+  unsigned long blockTime = micros() - start;
+
+  const float samples = (float)in.size() * rounds;
+  Serial.println(String("  ") + name + ": per-sample " + String(samples / (perSampleTime ? perSampleTime : 1), 1)
+                 + " MS/s, block " + String(samples / (blockTime ? blockTime : 1), 1) + " MS/s");
+}
+
+void benchmarkFilters() {
+  std::vector<float> in(4096);
+  for (size_t i = 0; i < in.size(); ++i) in[i] = random(0, 1000) / 10.0f;
+
+  Serial.println("Throughput (4096-sample blocks):");
+  benchmarkFilter("MovingAverage<16>", MovingAverage<float, 16>(), in);
+  benchmarkFilter("Ema", Ema<float>(0.2f), in);
+  benchmarkFilter("Biquad low-pass", Biquad<float>::lowPass(1000.0f, 50.0f), in);
+  benchmarkFilter("MedianFilter<5>", MedianFilter<float, 5>(), in);
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testFilterPipeline();
+  testMedianNaN();
+  benchmarkFilters();
+
+  delay(1000);
+}
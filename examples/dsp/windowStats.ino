@@ -0,0 +1,132 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Anomaly detection over the last 32 samples
+WindowStats<float, 32> stats;
+
+// Simulated sensor with a rare outlier
+IO<float> readSensor() {
+  return IO<float>([]() {
+    float noise = random(-100, 100) / 100.0f;
+    float outlier = (random(0, 100) == 0) ? 15.0f : 0.0f;
+    return 20.0f + noise + outlier;
+  });
+}
+
+// Either: Right(sample) if within 4 standard deviations of the window mean
+Either<float, String> checkSample() {
+  return readSensor()
+    .map([](float x) {
+      WindowSummary<float> s = stats.summary();  // Window before this sample
+      stats(x);
+      bool outlier = s.count > 8 && (x - s.mean) * (x - s.mean) > 16.0f * s.variance;
+      return outlier ? Either<float, String>::Left("Outlier " + String(x) + " (mean " + String(s.mean) + ")")
+                     : Either<float, String>::Right(x);
+    })
+    .run();
+}
+
+// expected output: window 32: min ~19.0, max ~21.0 (or ~35 with an outlier), mean ~20.0, variance ~0.3
+void testWindowStats() {
+  int outliers = 0;
+  for (int i = 0; i < 100; ++i) {
+    checkSample().match(
+      [&](const String& e) { ++outliers; Serial.println(e); },
+      [](float) {}
+    );
+  }
+  WindowSummary<float> s = stats.summary();
+  Serial.println("window " + String((unsigned long)s.count) + ": min " + String(s.min) + ", max " + String(s.max)
+                 + ", mean " + String(s.mean) + ", variance " + String(s.variance) + ", outliers " + String(outliers));
+
+  // Standalone min / max as map stages
+  static WindowMin<int, 4> min4;
+  static WindowMax<int, 4> max4;
+  int data[] = {5, 3, 8, 1, 9, 2, 7, 6};
+  String mins = "", maxs = "";
+  for (int x : data) {
+    auto show = [](int v) { return String(v) + " "; };
+    auto none = []() { return String("- "); };
+    mins += Maybe<int>::Just(x).map(stage(min4)).fold(show, none);
+    maxs += Maybe<int>::Just(x).map(stage(max4)).fold(show, none);
+  }
+  // expected output: min4: 5 3 3 1 1 1 1 2 / max4: 5 5 8 8 9 9 9 9
+  Serial.println("min4: " + mins + "/ max4: " + maxs);
+
+  // Integer samples (raw ADC counts): mean and variance are float by default
+  // expected output: int window: mean 1.50, variance 0.25
+  static WindowStats<int, 4> counts;
+  WindowStats<int, 4>::Summary c{};
+  for (int x : {1, 2, 1, 2}) c = counts(x);
+  Serial.println("int window: mean " + String(c.mean) + ", variance " + String(c.variance));
+}
+
+// =========== Benchmark: incremental vs. recompute-from-scratch ===========
+
+template<size_t N>
+void benchmarkWindow(const std::vector<float>& in) {
+  static WindowStats<float, N> incremental;  // static: too large for the stack at big N
+  static float ring[N];
+  volatile float sink = 0;
+
+  unsigned long start = micros();
+  for (float x : in) {
+    WindowSummary<float> s = incremental(x);
+    sink = sink + s.min + s.max + s.mean + s.variance;
+  }
+  unsigned long incrementalTime = micros() - start;
+
+  // Recompute over the window for a subset of samples (O(N) each)
+  const size_t recomputeSamples = (N >= 4096) ? 64 : 1024;
+  size_t head = 0;
+  start = micros();
+  for (size_t i = 0; i < recomputeSamples; ++i) {
+    ring[head] = in[i];
+    head = (head + 1 == N) ? 0 : head + 1;
+    float mn = ring[0], mx = ring[0], sum = 0;
+    for (size_t k = 0; k < N; ++k) {
+      if (ring[k] < mn) mn = ring[k];
+      if (ring[k] > mx) mx = ring[k];
+      sum += ring[k];
+    }
+    float mean = sum / N, var = 0;
+    for (size_t k = 0; k < N; ++k) var += (ring[k] - mean) * (ring[k] - mean);
+    sink = sink + mn + mx + mean + var / N;
+  }
+  unsigned long recomputeTime = micros() - start;
+
+  Serial.println("  N=" + String((unsigned long)N) + ": incremental "
+                 + String(incrementalTime * 1000.0f / in.size(), 1) + " ns/sample, recompute "
+                 + String(recomputeTime * 1000.0f / recomputeSamples, 1) + " ns/sample");
+}
+
+void benchmarkWindows() {
+  std::vector<float> in(200000);
+  for (size_t i = 0; i < in.size(); ++i) in[i] = random(0, 10000) / 100.0f;
+
+  Serial.println("Sliding-window min/max/mean/variance:");
+  benchmarkWindow<16>(in);
+  benchmarkWindow<256>(in);
+  benchmarkWindow<4096>(in);
+  benchmarkWindow<65536>(in);  // ~768 KB: host only
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testWindowStats();
+  benchmarkWindows();
+
+  delay(1000);
+}
@@ -0,0 +1,154 @@
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// =========== Small config: independent checks with mapN ===========
+
+struct WifiConfig {
+  String ssid;
+  int channel;
+  int txPower;
+};
+
+using Check = Validated<String, String, 4>;
+using CheckInt = Validated<int, String, 4>;
+
+// expected output: Invalid config (2 errors): channel must be 1..13; txPower must be 0..20
+void testValidatedConfig() {
+  String ssid = "funcy";
+  int channel = 42;
+  int txPower = 99;
+
+  Validated<WifiConfig, String, 4> config = mapN(
+    [](String s, int c, int p) { return WifiConfig{s, c, p}; },
+    Check::check(ssid, ssid.length() > 0, "ssid must not be empty"),
+    CheckInt::check(channel, channel >= 1 && channel <= 13, "channel must be 1..13"),
+    CheckInt::check(txPower, txPower >= 0 && txPower <= 20, "txPower must be 0..20")
+  );
+
+  config.match(
+    [](const ErrorBuffer<String, 4>& errors) {
+      Serial.print("Invalid config (" + String((unsigned long)errors.total()) + " errors):");
+      for (const String& e : errors) Serial.print(" " + e + ";");
+      Serial.println();
+    },
+    [](WifiConfig c) { Serial.println("Valid config for " + c.ssid); }
+  );
+}
+
+// An Invalid needs at least one error: an empty buffer gives Nothing, not a Valid T()
+// expected output: Invalid(no errors): Nothing / Invalid(1 error): 1 error
+void testInvalidFromBuffer() {
+  Check::Errors errors;
+  Check::Invalid(errors).match(
+    [](const Check&) { Serial.println("Invalid(no errors): Just"); },
+    []() { Serial.println("Invalid(no errors): Nothing"); }
+  );
+  errors.push("ssid must not be empty");
+  Check::Invalid(errors).match(
+    [](const Check& c) { Serial.println("Invalid(1 error): " + String((unsigned long)c.errors().total()) + " error"); },
+    []() { Serial.println("Invalid(1 error): Nothing"); }
+  );
+}
+
+// =========== Benchmark: 50-field config ===========
+
+const size_t FIELDS = 50;
+
+struct DeviceConfig {
+  int fields[FIELDS];
+};
+
+struct FieldError {
+  uint8_t field;
+  int value;
+};
+
+// Every field must be within [0, 1000]
+Validated<int, FieldError, 16> checkField(uint8_t field, int value) {
+  return Validated<int, FieldError, 16>::check(value, value >= 0 && value <= 1000, FieldError{field, value});
+}
+
+Either<DeviceConfig, FieldError> checkFieldEither(DeviceConfig c, uint8_t field) {
+  int v = c.fields[field];
+  if (v >= 0 && v <= 1000) return Either<DeviceConfig, FieldError>::Right(c);
+  return Either<DeviceConfig, FieldError>::Left(FieldError{field, v});
+}
+
+Validated<DeviceConfig, FieldError, 16> validateConfig(const DeviceConfig& raw) {
+  Validated<DeviceConfig, FieldError, 16> acc = Validated<DeviceConfig, FieldError, 16>::Valid(raw);
+  for (uint8_t i = 0; i < FIELDS; ++i) {
+    acc = acc.map2(checkField(i, raw.fields[i]), [](DeviceConfig c, int) { return c; });
+  }
+  return acc;
+}
+
+Either<DeviceConfig, FieldError> validateConfigEither(const DeviceConfig& raw) {
+  Either<DeviceConfig, FieldError> acc = Either<DeviceConfig, FieldError>::Right(raw);
+  for (uint8_t i = 0; i < FIELDS; ++i) {
+    acc = acc.flatMap([i](DeviceConfig c) { return checkFieldEither(c, i); });
+  }
+  return acc;
+}
+
+void benchmarkValidatedConfig() {
+  DeviceConfig raw;
+  for (size_t i = 0; i < FIELDS; ++i) raw.fields[i] = random(0, 1000);
+  // 5 broken fields
+  raw.fields[3] = -1; raw.fields[11] = 2000; raw.fields[20] = -5; raw.fields[33] = 5000; raw.fields[49] = -7;
+
+  const int rounds = 10000;
+  volatile size_t sink = 0;
+
+  // Either: one error per validation run, fix it, run again (round-trips)
+  unsigned long start = micros();
+  int roundTrips = 0;
+  for (int r = 0; r < rounds; ++r) {
+    DeviceConfig c = raw;
+    roundTrips = 0;
+    bool done = false;
+    while (!done) {
+      ++roundTrips;
+      validateConfigEither(c).match(
+        [&](FieldError e) { c.fields[e.field] = 0; },  // "report and fix" one field
+        [&](DeviceConfig) { done = true; }
+      );
+    }
+    sink = sink + roundTrips;
+  }
+  unsigned long eitherTime = micros() - start;
+
+  // Validated: all errors in a single run
+  start = micros();
+  size_t errors = 0;
+  for (int r = 0; r < rounds; ++r) {
+    errors = validateConfig(raw).errors().total();
+    sink = sink + errors;
+  }
+  unsigned long validatedTime = micros() - start;
+
+  Serial.println("50-field config with 5 errors, x" + String(rounds) + ":");
+  Serial.println("  Either:    " + String(roundTrips) + " round-trips, " + String(eitherTime) + " us");
+  Serial.println("  Validated: 1 run, " + String((unsigned long)errors) + " errors, " + String(validatedTime) + " us");
+  Serial.println("  sizeof(Validated<DeviceConfig, FieldError, 16>): "
+                 + String((unsigned long)sizeof(Validated<DeviceConfig, FieldError, 16>)) + " bytes (no heap)");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testValidatedConfig();
+  testInvalidFromBuffer();
+  benchmarkValidatedConfig();
+
+  delay(1000);
+}
@@ -0,0 +1,115 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Calibration constants, converted at compile time
+constexpr Q16_16 GAIN = Q16_16::fromFloat(0.0806f);    // ADC counts -> mV / 10
+constexpr Q16_16 OFFSET = Q16_16::fromFloat(-1.25f);
+constexpr Q16_16 ALPHA = Q16_16::fromFloat(0.125f);    // EMA factor
+constexpr Q16_16 LIMIT = Q16_16::fromFloat(300.0f);
+
+static_assert(Q8_8::fromInt(200) == Q8_8::max(), "fromInt saturates");
+static_assert((Q8_8::fromFloat(100.0f) + Q8_8::fromFloat(100.0f)) == Q8_8::max(), "+ saturates");
+static_assert(Q8_8::fromFloat(100.0f).checkedAdd(Q8_8::fromFloat(100.0f)).isLeft(), "checkedAdd detects it");
+static_assert((Q16_16::fromFloat(1.5f) * Q16_16::fromFloat(2.0f)) == Q16_16::fromInt(3), "* works");
+
+// fromFloatChecked at the exact range boundaries (value rounded to the nearest raw step)
+static_assert(Q8_8::fromFloatChecked(127.99609375f).unwrapRight() == Q8_8::max(), "Q8.8 max fits");
+static_assert(Q8_8::fromFloatChecked(127.998046875f).isLeft(), "Q8.8 max + half a step rounds out");
+static_assert(Q8_8::fromFloatChecked(-128.0f).unwrapRight() == Q8_8::min(), "Q8.8 min fits");
+static_assert(Q8_8::fromFloatChecked(-128.001953125f).unwrapLeft() == OverflowError::Underflow, "Q8.8 below min");
+static_assert(Q1_15::fromFloatChecked(1.0f).unwrapLeft() == OverflowError::Overflow, "Q1.15 1.0 overflows");
+static_assert(Q1_15::fromFloatChecked(-1.0f).unwrapRight() == Q1_15::min(), "Q1.15 -1.0 fits");
+static_assert(Q16_16::fromFloatChecked(32768.0f).unwrapLeft() == OverflowError::Overflow, "Q16.16 2^15 overflows");
+static_assert(Q16_16::fromFloatChecked(32767.0f).isRight(), "Q16.16 below 2^15 fits");
+static_assert(Q16_16::fromFloatChecked(-32768.0f).unwrapRight() == Q16_16::min(), "Q16.16 min fits");
+static_assert(Q16_16::fromFloatChecked(-32769.0f).unwrapLeft() == OverflowError::Underflow, "Q16.16 below min");
+static_assert(Q1_31::fromFloatChecked(1.0f).unwrapLeft() == OverflowError::Overflow, "Q1.31 1.0 overflows");
+static_assert(Q1_31::fromFloatChecked(0.99999994f).isRight(), "Q1.31 largest float below 1.0 fits");
+static_assert(Q1_31::fromFloatChecked(-1.0f).unwrapRight() == Q1_31::min(), "Q1.31 -1.0 fits");
+
+// Simulated 12-bit ADC read
+IO<int> readAdc() {
+  return IO<int>([]() { return (int)random(0, 4096); });
+}
+
+// expected output: Calibrated: ... ; 100 * 100 in Q8.8: Left Overflow
+void testFixedPipeline() {
+  // Fixed values flow through IO::map like any other value
+  float calibrated = readAdc()
+    .map(Q16_16::fromInt)
+    .map([](Q16_16 x) { return x * GAIN + OFFSET; })
+    .map([](Q16_16 x) { return x.toFloat(); })
+    .run();
+  Serial.println("Calibrated: " + String(calibrated));
+
+  // Overflow detection with Either
+  Q8_8::Checked result = Q8_8::fromFloatChecked(100.0f)
+    .flatMap([](Q8_8 x) { return x.checkedMul(Q8_8::fromFloat(100.0f)); });
+  result.match(
+    [](OverflowError e) { Serial.println(String("100 * 100 in Q8.8: Left ") + (e == OverflowError::Overflow ? "Overflow" : "Underflow")); },
+    [](Q8_8 x) { Serial.println("100 * 100 in Q8.8: Right " + String(x.toFloat())); }
+  );
+}
+
+// =========== Benchmark: calibrate -> EMA -> clamp, float vs. Q16.16 ===========
+// Instruction counts: build with -O2 -S (or objdump -d) and compare
+// filterChainFloat with filterChainFixed.
+
+float filterChainFloat(const std::vector<int>& raw) {
+  float ema = 0;
+  for (int r : raw) {
+    float x = r * 0.0806f - 1.25f;
+    ema = ema + 0.125f * (x - ema);
+    if (ema > 300.0f) ema = 300.0f;
+  }
+  return ema;
+}
+
+Q16_16 filterChainFixed(const std::vector<int>& raw) {
+  Q16_16 ema;
+  for (int r : raw) {
+    Q16_16 x = Q16_16::fromInt(r) * GAIN + OFFSET;
+    ema = ema + ALPHA * (x - ema);
+    if (ema > LIMIT) ema = LIMIT;
+  }
+  return ema;
+}
+
+void benchmarkFixedPoint() {
+  std::vector<int> raw(4096);
+  for (size_t i = 0; i < raw.size(); ++i) raw[i] = random(0, 4096);
+  const int rounds = 100;
+  volatile float sink = 0;
+
+  unsigned long start = micros();
+  for (int r = 0; r < rounds; ++r) sink = sink + filterChainFloat(raw);
+  unsigned long floatTime = micros() - start;
+
+  start = micros();
+  for (int r = 0; r < rounds; ++r) sink = sink + filterChainFixed(raw).toFloat();
+  unsigned long fixedTime = micros() - start;
+
+  Serial.println("filter chain over 4096 samples x" + String(rounds) + ": float "
+                 + String(floatTime) + " us, Q16.16 " + String(fixedTime) + " us");
+  Serial.println("  results: float " + String(filterChainFloat(raw)) + ", Q16.16 " + String(filterChainFixed(raw).toFloat()));
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testFixedPipeline();
+  benchmarkFixedPoint();
+
+  delay(1000);
+}
@@ -0,0 +1,114 @@
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+unsigned long sensorReads = 0;
+
+// Simulated slow sensor: ~2 ms per conversion
+IO<float> readTemperature() {
+  return IO<float>([]() {
+    ++sensorReads;
+    delayMicroseconds(2000);
+    return 20.0f + random(-10, 10) / 10.0f;
+  });
+}
+
+// Raw and cached versions of the same sensor
+IO<float> rawTemperature = readTemperature();
+IOCache<float> temperatureCache;   // Shared by every IO built from temperature
+IO<float> temperature = readTemperature().cached(temperatureCache, 500);  // Re-read at most every 500 ms
+
+// Three consumers per loop pass, all reading the same cache
+IO<float> display = temperature.map([](float c) { return c; });
+IO<float> logger = temperature.map([](float c) { return c * 1.8f + 32.0f; });
+IO<bool> control = temperature.map([](float c) { return c > 21.0f; });
+IO<bool> loopPass = display.then(logger).then(control);
+
+IO<float> rawDisplay = rawTemperature.map([](float c) { return c; });
+IO<float> rawLogger = rawTemperature.map([](float c) { return c * 1.8f + 32.0f; });
+IO<bool> rawControl = rawTemperature.map([](float c) { return c > 21.0f; });
+IO<bool> rawLoopPass = rawDisplay.then(rawLogger).then(rawControl);
+
+// Injectable clock: deterministic TTL test
+unsigned long fakeNow = 0;
+unsigned long fakeClock() { return fakeNow; }
+
+// expected output: memoize: 1 read for 3 runs; shared: 1 read for map / then / liftIO / copy;
+//                  after invalidate: 2 reads; cached(100): reads 1 1 2 2 3
+void testCachedIO() {
+  sensorReads = 0;
+  static IOCache<float> onceCache;
+  IO<float> once = readTemperature().memoize(onceCache);
+  float a = once.run(), b = once.run(), c = once.run();
+  Serial.println("memoize: " + String(sensorReads) + " read for 3 runs (" + String(a == b && b == c ? "same" : "different") + " values)");
+
+  // The cell is shared however the memoized IO is combined: map captures the IO,
+  // then / liftIO / a copy copy its closure; all of them read the same cell
+  sensorReads = 0;
+  static IOCache<float> sharedCache;
+  IO<float> shared = readTemperature().memoize(sharedCache);
+  IO<float> viaMap = shared.map([](float c) { return c; });
+  IO<float> viaThen = IO<void>([]() {}).then(shared);
+  IO<Either<float, String>> viaLift = liftIO<float, String>(shared);
+  IO<float> viaCopy = shared;
+  viaMap.run();
+  viaThen.run();
+  viaLift.run();
+  viaCopy.run();
+  Serial.println("shared: " + String(sensorReads) + " read for map / then / liftIO / copy");
+  sharedCache.invalidate();
+  viaThen.run();
+  viaMap.run();
+  Serial.println("after invalidate: " + String(sensorReads) + " reads");
+
+  sensorReads = 0;
+  fakeNow = 0;
+  static IOCache<float> ttlCache;
+  IO<float> ttl = readTemperature().cached(ttlCache, 100, fakeClock);
+  String reads = "";
+  for (unsigned long t : {0UL, 99UL, 100UL, 150UL, 250UL}) {
+    fakeNow = t;
+    ttl.run();
+    reads += String(sensorReads) + " ";
+  }
+  Serial.println("cached(100): reads " + reads);
+}
+
+// Benchmark: one loop pass with three consumers, raw vs. cached
+void benchmarkCachedIO() {
+  const int passes = 50;
+
+  sensorReads = 0;
+  unsigned long start = micros();
+  for (int i = 0; i < passes; ++i) rawLoopPass.run();
+  unsigned long rawTime = micros() - start;
+  unsigned long rawReads = sensorReads;
+
+  sensorReads = 0;
+  start = micros();
+  for (int i = 0; i < passes; ++i) loopPass.run();
+  unsigned long cachedTime = micros() - start;
+  unsigned long cachedReads = sensorReads;
+
+  Serial.println(String(passes) + " loop passes x 3 consumers: raw " + String(rawReads) + " reads, "
+                 + String(rawTime / passes) + " us/pass; cached " + String(cachedReads) + " reads, "
+                 + String(cachedTime / passes) + " us/pass");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testCachedIO();
+  benchmarkCachedIO();
+
+  delay(1000);
+}
@@ -0,0 +1,210 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <array>       // Table of the template pipelines
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// 0: both paths, 1: template IO chains only, 2: EffectVM only (compare the flash size)
+#ifndef EFFECTVM_EXAMPLE_PATH
+#define EFFECTVM_EXAMPLE_PATH 0
+#endif
+
+const uint8_t OutOfRange = 1;
+
+// ---------- Shared functions (registered once with the VM) ----------
+float readAdc() { return (float)random(0, 1024); }
+float multiply(float a, float b) { return a * b; }
+float add(float a, float b) { return a + b; }
+
+Either<float, uint8_t> checkRange(float v) {
+  return (v >= 0.0f && v <= 100.0f) ? Either<float, uint8_t>::Right(v) : Either<float, uint8_t>::Left(OutOfRange);
+}
+
+// Misbehaving bind: 0 is not a valid error code
+Either<float, uint8_t> zeroCode(float) { return Either<float, uint8_t>::Left(0); }
+
+// 20 sensor channels: same pipeline shape, different calibration
+const int channels = 20;
+constexpr float gainOf(int i) { return 0.05f + i * 0.01f; }
+constexpr float offsetOf(int i) { return -5.0f + i; }
+constexpr float fallbackOf(int i) { return 20.0f + i; }
+
+#if EFFECTVM_EXAMPLE_PATH != 2
+// ---------- Template path: one IO chain (and instantiation) per channel ----------
+template<int I>
+Either<float, uint8_t> templatePipeline(float input) {
+  return IO<float>([input]() { return input; })
+    .map([](float v) { return v * gainOf(I) + offsetOf(I); })
+    .map([](float v) {
+      const Either<float, uint8_t> checked = checkRange(v);
+      return checked.isRight() ? checked : Either<float, uint8_t>::Right(fallbackOf(I));
+    })
+    .run();
+}
+
+template<int... I>
+constexpr auto templateTable(std::integer_sequence<int, I...>) {
+  return std::array<Either<float, uint8_t> (*)(float), sizeof...(I)>{{&templatePipeline<I>...}};
+}
+
+const auto templatePipelines = templateTable(std::make_integer_sequence<int, channels>());
+#endif
+
+#if EFFECTVM_EXAMPLE_PATH != 1
+// ---------- VM path: one interpreter, 20 programs of 42 bytes ----------
+EffectVM<float> vm;
+ProgramBuilder<float, 48> builders[channels];
+EffectProgram programs[channels];
+
+// r0 = input * gain + offset, checked, fallback on Left
+EffectProgram buildChannel(ProgramBuilder<float, 48>& b, int i) {
+  b.input(0)
+   .constant(1, gainOf(i)).map2(0, 0, 1, 0)     // map2 0: multiply
+   .constant(1, offsetOf(i)).map2(0, 0, 1, 1)   // map2 1: add
+   .bind(0, 0, 0)                               // bind 0: checkRange
+   .branchLeft(0)
+   .ret(0)
+   .label(0).recover().constant(0, fallbackOf(i)).ret(0);
+  return b.build().fold(
+    [](ProgramError) { Serial.println("build failed"); return EffectProgram(); },
+    [](EffectProgram p) { return p; }
+  );
+}
+
+void setupVM() {
+  vm.addEffect(readAdc);
+  vm.addMap2(multiply);
+  vm.addMap2(add);
+  vm.addBind(checkRange);
+  vm.addBind(zeroCode);
+  for (int i = 0; i < channels; ++i) programs[i] = buildChannel(builders[i], i);
+}
+
+void printResult(const char* label, const Either<float, uint8_t>& r) {
+  r.match(
+    [=](uint8_t code) { Serial.println(String(label) + "Left(" + String(code) + ")"); },
+    [=](float v) { Serial.println(String(label) + "Right(" + String(v) + ")"); }
+  );
+}
+
+// expected output: channel 3 program: 42 bytes / input 500: Right(38.00) / input 2000: Right(23.00) (fallback)
+//                  adc program: Right(..) or Left(1) / fail program: Left(7) / corrupt program: Left(255)
+//                  register 9 program: Left(255) / build errors: register 9 -> 7, label 8 -> 5, 3 jumps / 1 label -> 6
+//                  fail(0): build error 4 (reserved) / zero bind: Left(255)
+void testEffectVM() {
+  Serial.println("channel 3 program: " + String((unsigned long)programs[3].size()) + " bytes");
+  printResult("input 500: ", vm.run(programs[3], 500.0f));
+  printResult("input 2000: ", vm.run(programs[3], 2000.0f));
+
+  // Effect instead of input, error left unhandled
+  ProgramBuilder<float, 32> adc;
+  adc.effect(0, 0).constant(1, 0.2f).map2(0, 0, 1, 0).bind(0, 0, 0).ret(0);
+  printResult("adc program: ", vm.run(adc.build().unwrapRight()));
+
+  // fail sets Left, the map after it is skipped
+  ProgramBuilder<float, 16> failing;
+  failing.input(0).fail(7).map2(0, 0, 0, 1).ret(0);
+  printResult("fail program: ", vm.run(failing.build().unwrapRight(), 1.0f));
+
+  // Unknown function id: rejected, not called
+  const uint8_t corrupt[] = {uint8_t(EffectOp::Input), 0, uint8_t(EffectOp::Map2), 0, 0, 0, 9, uint8_t(EffectOp::Return), 0};
+  printResult("corrupt program: ", vm.run(EffectProgram(corrupt, sizeof(corrupt)), 1.0f));
+
+  // Register 9 does not exist: rejected, not masked to r1
+  const uint8_t badRegister[] = {uint8_t(EffectOp::Input), 9, uint8_t(EffectOp::Return), 0};
+  printResult("register 9 program: ", vm.run(EffectProgram(badRegister, sizeof(badRegister)), 1.0f));
+
+  // Builder errors name the actual problem
+  ProgramBuilder<float, 16> registerOut;
+  registerOut.input(9).ret(9);
+  ProgramBuilder<float, 16> labelOut;
+  labelOut.input(0).branchLeft(8).ret(0);
+  ProgramBuilder<float, 64, 1> jumps;
+  jumps.input(0).branchLeft(0).branchLeft(0).branchLeft(0).label(0).ret(0);
+  Serial.println("build errors: register 9 -> " + String(uint8_t(registerOut.build().unwrapLeft()))
+                 + ", label 8 -> " + String(uint8_t(labelOut.build().unwrapLeft()))
+                 + ", 3 jumps / 1 label -> " + String(uint8_t(jumps.build().unwrapLeft())));
+
+  // Code 0 marks Right in runBatch: fail(0) is rejected, a bind's Left(0) becomes Fault
+  ProgramBuilder<float, 16> reserved;
+  reserved.input(0).fail(0).ret(0);
+  reserved.build().fold(
+    [](ProgramError e) { Serial.println("fail(0): build error " + String(uint8_t(e)) + " (reserved)"); },
+    [](EffectProgram) { Serial.println("fail(0): built"); }
+  );
+  ProgramBuilder<float, 16> zeroBind;
+  zeroBind.input(0).bind(0, 0, 1).ret(0);   // bind 1: zeroCode
+  printResult("zero bind: ", vm.run(zeroBind.build().unwrapRight(), 1.0f));
+}
+#endif
+
+// ---------- Benchmark ----------
+const int samples = 256;
+float inputs[samples];
+float values[samples];
+uint8_t errors[samples];
+volatile float sink = 0;
+
+void benchmarkEffectVM() {
+  for (int i = 0; i < samples; ++i) inputs[i] = (float)random(0, 1024);
+  const int rounds = 20;
+  const long runs = (long)rounds * channels * samples;
+
+#if EFFECTVM_EXAMPLE_PATH != 2
+  unsigned long start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    for (int c = 0; c < channels; ++c) {
+      for (int i = 0; i < samples; ++i) sink = sink + templatePipelines[c](inputs[i]).unwrapRight();
+    }
+  }
+  Serial.println("template IO chains:  " + String((micros() - start) * 1000.0f / runs, 1) + " ns/run");
+#endif
+
+#if EFFECTVM_EXAMPLE_PATH != 1
+  unsigned long vmStart = micros();
+  for (int r = 0; r < rounds; ++r) {
+    for (int c = 0; c < channels; ++c) {
+      for (int i = 0; i < samples; ++i) sink = sink + vm.run(programs[c], inputs[i]).unwrapRight();
+    }
+  }
+  Serial.println("EffectVM run:        " + String((micros() - vmStart) * 1000.0f / runs, 1) + " ns/run");
+
+  size_t rights = 0;
+  vmStart = micros();
+  for (int r = 0; r < rounds; ++r) {
+    for (int c = 0; c < channels; ++c) rights += vm.runBatch(programs[c], inputs, samples, values, errors);
+  }
+  Serial.println("EffectVM runBatch:   " + String((micros() - vmStart) * 1000.0f / runs, 1) + " ns/run ("
+                 + String((unsigned long)rights) + " Right)");
+#endif
+
+#if EFFECTVM_EXAMPLE_PATH == 0
+  // Both paths agree
+  int mismatches = 0;
+  for (int c = 0; c < channels; ++c) {
+    for (int i = 0; i < samples; ++i) {
+      if (templatePipelines[c](inputs[i]).unwrapRight() != vm.run(programs[c], inputs[i]).unwrapRight()) ++mismatches;
+    }
+  }
+  Serial.println("mismatches: " + String(mismatches));
+#endif
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+#if EFFECTVM_EXAMPLE_PATH != 1
+  setupVM();
+  testEffectVM();
+#endif
+  benchmarkEffectVM();
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  delay(1000);
+}
@@ -0,0 +1,107 @@
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+IO<int> readSensor() {
+  return IO<int>([]() { return (int)random(0, 1024); });
+}
+
+IO<int> sensor = readSensor();
+auto sampler = every(sensor, 100);   // every 100 ms (millis), global: keeps its schedule
+
+// expected output (once per 100 ms): sample: ... / every 10 runs: runs, overruns, p99 lateness
+void testEvery() {
+  sampler.poll().match(
+    [](int v) {
+      if (sampler.runs() % 10 == 0) {
+        Serial.println("sample: " + String(v) + ", runs " + String(sampler.runs()) + ", overruns "
+                       + String(sampler.overruns()) + ", p99 lateness " + String(sampler.jitter().p99()) + " ms");
+      }
+    },
+    []() {}
+  );
+}
+
+// ---------- Benchmark: period accuracy under varying chain costs ----------
+// The chain busy-waits for its cost, the schedule runs on micros()
+
+const unsigned long periodUs = 2000;
+const int periods = 300;
+
+unsigned long chainCost = 0;        // Cost of the next run (set by the scenario)
+unsigned long firstStart = 0, lastStart = 0;
+int started = 0;
+
+void spinFor(unsigned long us) {
+  const unsigned long begin = micros();
+  while (micros() - begin < us) {}
+}
+
+IO<void> chain = IO<void>([]() {
+  lastStart = micros();
+  if (started++ == 0) firstStart = lastStart;
+  spinFor(chainCost);
+});
+
+// Cost of run i: mostly 10..40 % of the period, every 50th run 1.5 periods
+unsigned long costOf(int i) {
+  if (i % 50 == 49) return periodUs * 3 / 2;
+  return periodUs / 10 + (unsigned long)random(0, periodUs * 3 / 10);
+}
+
+// Drift: how far the last run is from where a perfect schedule puts it
+void report(const char* label) {
+  const long ideal = (long)(periodUs * (started - 1));
+  const long actual = (long)(lastStart - firstStart);
+  Serial.println(String(label) + "runs " + String(started) + ", mean period "
+                 + String(actual / (float)(started - 1), 1) + " us (target " + String(periodUs)
+                 + "), drift " + String(actual - ideal) + " us");
+}
+
+void benchmarkDelayPacing() {
+  started = 0;
+  for (int i = 0; i < periods; ++i) {
+    chainCost = costOf(i);
+    chain.run();
+    delayMicroseconds(periodUs);  // The pattern at the end of loop()
+  }
+  report("delay(period):   ");
+}
+
+void benchmarkFixedRate(OverrunPolicy policy, const char* label) {
+  started = 0;
+  auto runner = every(chain, periodUs, policy, micros);
+  const unsigned long end = micros() + periodUs * periods;
+  while ((long)(micros() - end) < 0) {
+    chainCost = costOf(started);
+    runner.poll();
+  }
+  report(label);
+  const JitterHistogram& j = runner.jitter();
+  Serial.println("                 lateness min " + String(j.min()) + " / max " + String(j.max())
+                 + " / p99 " + String(j.p99()) + " us, overruns " + String(runner.overruns())
+                 + ", skipped " + String(runner.skipped()));
+}
+
+void benchmarkEvery() {
+  Serial.println(String(periods) + " periods of " + String(periodUs) + " us, chain cost 10-40 % (every 50th: 150 %):");
+  benchmarkDelayPacing();
+  benchmarkFixedRate(OverrunPolicy::CatchUp, "every, CatchUp:  ");
+  benchmarkFixedRate(OverrunPolicy::Skip, "every, Skip:     ");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+  benchmarkEvery();
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testEvery();   // No delay(): every() paces the sampling
+}
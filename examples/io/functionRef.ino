@@ -0,0 +1,137 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <functional> // Required for std::function (benchmark baseline)
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+IO<int> readSensor() {
+  return IO<int>([]() { return (int)random(-10, 100); });
+}
+
+int toErrorCode(int value) { return value; }
+bool isNegative(int value) { return value < 0; }
+
+// expected output: run: ... / errors: ... / match: ... (out of range for negative or > 90 readings)
+void testFunctionRef() {
+  // Synchronous: capturing lambdas are fine, they only live during the call
+  int limit = 90;
+  Either<int, String> checked = runIOtoEither<int, String>(
+    readSensor(),
+    [limit](int v) { return "out of range: " + String(v) + " (limit " + String(limit) + ")"; },
+    [limit](int v) { return v < 0 || v > limit; }
+  );
+  checked.match(
+    [](const String& err) { Serial.println("run: " + err); },
+    [](int ok) { Serial.println("run: " + String(ok)); }
+  );
+
+  // Function pointers convert too; value and error types are independent (Either<int, uint8_t>)
+  Either<int, uint8_t> code = runIOtoEither<int, uint8_t>(
+    readSensor(),
+    [](int) { return uint8_t(1); },
+    isNegative
+  );
+  Serial.println(String("errors: ") + (code.isLeft() ? "Left " + String(code.unwrapLeft()) : "Right " + String(code.unwrapRight())));
+
+  // match / fold take any callable, FunctionRef included
+  int offset = 1000;
+  auto onJust = [offset](int v) { Serial.println("match: " + String(v + offset)); };
+  Maybe<int>::Just(42).match(FunctionRef<void(int)>(onJust), []() { Serial.println("match: Nothing"); });
+}
+
+// ---------- Benchmarks ----------
+// The callees are not inlined, so the call through each wrapper is what gets measured
+
+__attribute__((noinline)) long sumPointer(int (*f)(int), int n) {
+  long sum = 0;
+  for (int i = 0; i < n; ++i) sum += f(i);
+  return sum;
+}
+
+__attribute__((noinline)) long sumRef(FunctionRef<int(int)> f, int n) {
+  long sum = 0;
+  for (int i = 0; i < n; ++i) sum += f(i);
+  return sum;
+}
+
+__attribute__((noinline)) long sumFunction(const std::function<int(int)>& f, int n) {
+  long sum = 0;
+  for (int i = 0; i < n; ++i) sum += f(i);
+  return sum;
+}
+
+__attribute__((noinline)) int applyRef(FunctionRef<int(int)> f, int x) { return f(x); }
+__attribute__((noinline)) int applyFunction(std::function<int(int)> f, int x) { return f(x); }
+
+int scaleBy3(int x) { return x * 3; }
+
+void printNs(const char* label, unsigned long elapsedUs, long count) {
+  Serial.println(String(label) + String(elapsedUs * 1000.0f / count, 2) + " ns");
+}
+
+// Benchmark: indirect call overhead, and wrapper construction + call per invocation
+void benchmarkCallOverhead() {
+  const int n = 100000;
+  volatile long sink = 0;
+  int factor = 3;
+  auto scale = [factor](int x) { return x * factor; };
+  std::function<int(int)> scaleFunction = scale;
+
+  unsigned long start = micros();
+  sink = sink + sumPointer(scaleBy3, n);
+  printNs("call, function pointer:       ", micros() - start, n);
+
+  start = micros();
+  sink = sink + sumRef(scale, n);
+  printNs("call, FunctionRef:            ", micros() - start, n);
+
+  start = micros();
+  sink = sink + sumFunction(scaleFunction, n);
+  printNs("call, const std::function&:   ", micros() - start, n);
+
+  // A capturing lambda passed per call: std::function is built (and destroyed) every time
+  start = micros();
+  for (int i = 0; i < n; ++i) sink = sink + applyRef([factor](int x) { return x * factor; }, i);
+  printNs("construct + call, FunctionRef:   ", micros() - start, n);
+
+  start = micros();
+  for (int i = 0; i < n; ++i) sink = sink + applyFunction([factor](int x) { return x * factor; }, i);
+  printNs("construct + call, std::function: ", micros() - start, n);
+}
+
+// Benchmark: liftIOtoEither(...).run() with std::function vs. runIOtoEither with FunctionRef
+void benchmarkLiftIOtoEither() {
+  const int n = 20000;
+  volatile int sink = 0;
+  IO<int> sensor = IO<int>([]() { return (int)random(-10, 100); });
+
+  unsigned long start = micros();
+  for (int i = 0; i < n; ++i) {
+    sink = sink + liftIOtoEither<int, int>(sensor, toErrorCode, isNegative).run().isRight();
+  }
+  printNs("liftIOtoEither, std::function: ", micros() - start, n);
+
+  start = micros();
+  for (int i = 0; i < n; ++i) {
+    sink = sink + runIOtoEither<int, int>(sensor, toErrorCode, isNegative).isRight();
+  }
+  printNs("runIOtoEither:                 ", micros() - start, n);
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testFunctionRef();
+  benchmarkCallOverhead();
+  benchmarkLiftIOtoEither();
+
+  delay(1000);
+}
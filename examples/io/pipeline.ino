@@ -0,0 +1,83 @@
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Simulated 12-bit ADC
+int readAdcRaw() {
+  return (int)random(0, 4096);
+}
+
+IO<int> readAdc() {
+  return IO<int>([]() { return readAdcRaw(); });
+}
+
+// Built once: the stages (including the filter state) live inside the pipeline
+auto calibrate = pipeline<int>()
+  .map([](int raw) { return raw * 0.0806f; })              // counts -> mV / 10
+  .map(Ema<float>(0.2f))                                   // owned filter state
+  .map([](float v) { return v > 300.0f ? Maybe<float>::Nothing() : Maybe<float>::Just(v); })
+  .flatMap([](float v) { return v < 5.0f ? Maybe<int>::Nothing() : Maybe<int>::Just(int(v * 10)); });
+
+// expected output: Pipeline: Just ... / via IO stage: Just ...
+void testPipeline() {
+  calibrate.run(readAdcRaw()).match(
+    [](int v) { Serial.println("Pipeline: Just " + String(v)); },
+    []() { Serial.println("Pipeline: Nothing"); }
+  );
+
+  // A pipeline is a stage too
+  readAdc().map(stage(calibrate)).run().match(
+    [](int v) { Serial.println("via IO stage: Just " + String(v)); },
+    []() { Serial.println("via IO stage: Nothing"); }
+  );
+}
+
+// =========== Benchmark: per-iteration cost ===========
+// Before: the chain is rebuilt on every loop() pass (closures + std::function per stage)
+// After: Pipeline built once, stages composed at compile time, input as a parameter
+
+float emaState = 0;
+
+Maybe<int> rebuildEachIteration(int raw) {
+  return IO<int>([raw]() { return raw; })
+    .map([](int r) { return r * 0.0806f; })
+    .map([](float v) { emaState += 0.2f * (v - emaState); return emaState; })
+    .map([](float v) { return v > 300.0f ? Maybe<float>::Nothing() : Maybe<float>::Just(v); })
+    .map([](Maybe<float> m) { return m.flatMap([](float v) { return v < 5.0f ? Maybe<int>::Nothing() : Maybe<int>::Just(int(v * 10)); }); })
+    .run();
+}
+
+void benchmarkPipeline() {
+  const long iterations = 100000;
+  volatile int sink = 0;
+  auto consume = [&](const Maybe<int>& m) { sink = sink + m.fold([](int v) { return v; }, []() { return 0; }); };
+
+  unsigned long start = micros();
+  for (long i = 0; i < iterations; ++i) consume(rebuildEachIteration(int(i & 4095)));
+  unsigned long rebuildTime = micros() - start;
+
+  start = micros();
+  for (long i = 0; i < iterations; ++i) consume(calibrate.run(int(i & 4095)));
+  unsigned long pipelineTime = micros() - start;
+
+  Serial.println("per iteration: rebuilt IO chain " + String(rebuildTime * 1000.0f / iterations, 1)
+                 + " ns, Pipeline " + String(pipelineTime * 1000.0f / iterations, 1) + " ns");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testPipeline();
+  benchmarkPipeline();
+
+  delay(1000);
+}
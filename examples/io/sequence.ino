@@ -0,0 +1,104 @@
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+IO<void> logIO(String msg) {
+  return IO<void>([=]() { Serial.println(msg); });
+}
+
+IO<float> readTemperature() {
+  return IO<float>([]() { return 20.0f + random(0, 50) / 10.0f; });
+}
+
+// expected output: init serial / init sensors / calibrate / temperature: 2x.xx (4 effects)
+void testSequence() {
+  auto startup = sequenceOf(logIO("init serial"))
+    .then(logIO("init sensors"))
+    .then(logIO("calibrate"))
+    .then(readTemperature());
+  float t = startup.run();
+  Serial.println("temperature: " + String(t) + " (" + String((unsigned long)startup.size()) + " effects)");
+}
+
+volatile unsigned long counter = 0;
+
+// Read, then store: no compound assignment / assignment result on a volatile (-Wvolatile, C++20)
+unsigned long bump() {
+  const unsigned long v = counter + 1;
+  counter = v;
+  return v;
+}
+
+IO<void> tick() {
+  return IO<void>([]() { bump(); });
+}
+
+IO<int> sample() {
+  return IO<int>([]() { return (int)bump(); });
+}
+
+// Benchmark: 100 effects, IO::then chain vs. Sequence (built once, run many times)
+void benchmarkSequence() {
+  const int effects = 100;
+  const int runs = 10000;
+
+  // IO<void> effects
+  IO<void> nested = tick();
+  for (int i = 1; i < effects; ++i) nested = nested.then(tick());
+  Sequence<void> flat = sequenceOf(tick());
+  flat.reserve(effects);
+  for (int i = 1; i < effects; ++i) flat = std::move(flat).then(tick());
+  IO<void> flatIO = flat.toIO();
+
+  unsigned long start = micros();
+  for (int r = 0; r < runs; ++r) nested.run();
+  const float nestedNs = (micros() - start) * 1000.0f / (runs * effects);
+
+  start = micros();
+  for (int r = 0; r < runs; ++r) flat.run();
+  const float flatNs = (micros() - start) * 1000.0f / (runs * effects);
+
+  start = micros();
+  for (int r = 0; r < runs; ++r) flatIO.run();
+  const float flatIONs = (micros() - start) * 1000.0f / (runs * effects);
+
+  Serial.println("100 x IO<void>: then " + String(nestedNs, 2) + " ns/effect, Sequence "
+                 + String(flatNs, 2) + " ns/effect, Sequence.toIO() " + String(flatIONs, 2) + " ns/effect");
+
+  // IO<int> effects (results discarded, as with then)
+  IO<int> nestedInt = sample();
+  for (int i = 1; i < effects; ++i) nestedInt = nestedInt.then(sample());
+  Sequence<int> flatInt = sequenceOf(sample());
+  flatInt.reserve(effects);
+  for (int i = 1; i < effects; ++i) flatInt = std::move(flatInt).then(sample());
+
+  volatile unsigned long sink = 0;
+  start = micros();
+  for (int r = 0; r < runs; ++r) sink = sink + nestedInt.run();
+  const float nestedIntNs = (micros() - start) * 1000.0f / (runs * effects);
+
+  start = micros();
+  for (int r = 0; r < runs; ++r) sink = sink + flatInt.run();
+  const float flatIntNs = (micros() - start) * 1000.0f / (runs * effects);
+
+  Serial.println("100 x IO<int>:  then " + String(nestedIntNs, 2) + " ns/effect, Sequence "
+                 + String(flatIntNs, 2) + " ns/effect");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testSequence();
+  benchmarkSequence();
+
+  delay(1000);
+}
@@ -0,0 +1,105 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <utility> // Required for std::index_sequence
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Simulated 12-bit ADC channel I
+template<int I>
+int readChannel() {
+  return (int)random(0, 4096) + I;
+}
+
+// 50 sensor pipelines as constants: no constructor runs before setup(), stored in flash
+template<int I>
+constexpr auto staticPipeline = staticIO(readChannel<I>)
+  .map([](int raw) { return raw * (0.08f + I * 0.001f); })
+  .map([](float v) { return v < 300.0f ? v : 300.0f; });
+
+// The same 50 pipelines as std::function-based IO globals (dynamic initialization)
+template<int I>
+IO<float> dynamicPipeline = IO<float>([]() {
+  float v = readChannel<I>() * (0.08f + I * 0.001f);
+  return v < 300.0f ? v : 300.0f;
+});
+
+// Range checked variant with Maybe
+constexpr auto checkedChannel = staticIO(readChannel<0>)
+  .map([](int raw) { return raw * 0.0806f; })
+  .map([](float mv) { return mv > 300.0f ? Maybe<float>::Nothing() : Maybe<float>::Just(mv); });
+
+// expected output: static: ... / checked: Just ... or Nothing / as IO: ...
+void testStaticIO() {
+  Serial.println("static: " + String(staticPipeline<7>.run()));
+  checkedChannel.run().match(
+    [](float v) { Serial.println("checked: Just " + String(v)); },
+    []() { Serial.println("checked: Nothing"); }
+  );
+  IO<float> io = staticPipeline<3>.toIO();  // Interoperates with the runtime IO API
+  Serial.println("as IO: " + String(io.map([](float v) { return v * 2; }).run()));
+}
+
+// =========== Report: 50 pipelines, startup work and RAM ===========
+
+template<size_t... I>
+float runAllStatic(std::index_sequence<I...>) { return (staticPipeline<I>.run() + ...); }
+
+template<size_t... I>
+float runAllDynamic(std::index_sequence<I...>) { return (dynamicPipeline<I>.run() + ...); }
+
+template<size_t... I>
+constexpr size_t staticBytes(std::index_sequence<I...>) { return (sizeof(staticPipeline<I>) + ...); }
+
+// What the dynamic initializers do before setup(): construct 50 std::function objects
+template<size_t... I>
+void constructDynamic(std::index_sequence<I...>) {
+  IO<float> pipelines[] = { IO<float>([]() {
+    float v = readChannel<I>() * (0.08f + I * 0.001f);
+    return v < 300.0f ? v : 300.0f;
+  })... };
+  volatile size_t sink = sizeof(pipelines);
+  (void)sink;
+}
+
+void reportStaticIO() {
+  using Fifty = std::make_index_sequence<50>;
+  const int rounds = 1000;
+
+  unsigned long start = micros();
+  for (int r = 0; r < rounds; ++r) constructDynamic(Fifty());
+  unsigned long constructTime = micros() - start;
+
+  volatile float sink = 0;
+  start = micros();
+  for (int r = 0; r < rounds; ++r) sink = sink + runAllDynamic(Fifty());
+  unsigned long dynamicRun = micros() - start;
+
+  start = micros();
+  for (int r = 0; r < rounds; ++r) sink = sink + runAllStatic(Fifty());
+  unsigned long staticRun = micros() - start;
+
+  Serial.println("50 pipelines:");
+  Serial.println("  IO globals: " + String((unsigned long)(50 * sizeof(IO<float>))) + " bytes RAM (plus init guards), "
+                 + String(constructTime * 1000.0f / rounds, 0) + " ns of constructors before setup()");
+  Serial.println("  StaticIO:   0 bytes RAM (" + String((unsigned long)staticBytes(Fifty()))
+                 + " bytes read-only), 0 ns before setup()");
+  Serial.println("  run all 50: IO " + String(dynamicRun * 1000.0f / rounds, 0) + " ns, StaticIO "
+                 + String(staticRun * 1000.0f / rounds, 0) + " ns");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testStaticIO();
+  reportStaticIO();
+
+  delay(1000);
+}
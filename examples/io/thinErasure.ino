@@ -0,0 +1,66 @@
+// Build this sketch twice, with and without -DFUNCYCONTROLLERCPP_THIN_ERASURE
+// (e.g. build_flags in PlatformIO), and compare the printed numbers and the text size.
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+#if defined(FUNCYCONTROLLERCPP_THIN_ERASURE)
+const char* erasureMode = "ThinFunction";
+#else
+const char* erasureMode = "std::function";
+#endif
+
+IO<int> readAdc() {
+  return IO<int>([]() { return (int)random(0, 4096); });
+}
+
+IO<void> logIO(String msg) {
+  return IO<void>([=]() { Serial.println(msg); });
+}
+
+// Every distinct lambda below is one erased callable type
+int runChain() {
+  return readAdc()
+    .map([](int raw) { return raw * 2; })
+    .map([](int x) { return x + 1; })
+    .map([](int x) { return x / 3; })
+    .flatMap([](int x) { return IO<int>([x]() { return x - 1; }); })
+    .run();
+}
+
+// expected output: mode: ..., chain result: ...
+void testThinErasure() {
+  Serial.println(String("mode: ") + erasureMode + ", sizeof(IO<int>) = " + String((unsigned long)sizeof(IO<int>)));
+  Serial.println("chain result: " + String(runChain()));
+  logIO("String captures work in both modes").run();
+}
+
+// Benchmark: build + run a 4-stage chain (construction, copies, calls)
+void benchmarkThinErasure() {
+  const long iterations = 100000;
+  volatile int sink = 0;
+
+  unsigned long start = micros();
+  for (long i = 0; i < iterations; ++i) sink = sink + runChain();
+  unsigned long elapsed = micros() - start;
+
+  Serial.println(String(erasureMode) + ": build + run " + String(elapsed * 1000.0f / iterations, 1) + " ns/chain");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testThinErasure();
+  benchmarkThinErasure();
+
+  delay(1000);
+}
@@ -0,0 +1,112 @@
+// The benchmark goes up to n = 100000 (400 KB per buffer): run it on a host or
+// reduce the sizes for small boards.
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Simulated ADC read of one channel
+IO<int> readChannel(int channel) {
+  return IO<int>([channel]() { return channel * 100 + (int)random(0, 10); });
+}
+
+// Checked read: Left for a disconnected channel
+IO<Either<int, String>> readChecked(int channel) {
+  return IO<Either<int, String>>([channel]() {
+    if (channel == 3) return Either<int, String>::Left("channel 3 disconnected");
+    return Either<int, String>::Right(channel * 100);
+  });
+}
+
+// expected output: traverse: 0.. 100.. 200.. 300.. / sequence: 4 values /
+// traverseIOEither: channel 3 disconnected / first 2 channels ok: 2 values
+void testTraverse() {
+  int channels[] = {0, 1, 2, 3};
+  int raw[4];
+
+  traverse(channels, 4, readChannel, raw).run();
+  Serial.print("traverse:");
+  for (int v : raw) Serial.print(" " + String(v));
+  Serial.println();
+
+  IO<int> reads[] = {readChannel(5), readChannel(6), readChannel(7), readChannel(8)};
+  std::vector<int> values = sequence(reads, 4).run();
+  Serial.println("sequence: " + String((unsigned long)values.size()) + " values");
+
+  std::vector<int> checked;
+  traverseIOEither(channels, 4, readChecked, checked).run().match(
+    [](const String& err) { Serial.println("traverseIOEither: " + err); },
+    [](size_t n) { Serial.println("traverseIOEither: " + String((unsigned long)n) + " values"); }
+  );
+
+  int firstTwo[] = {1, 2};
+  traverseIOEither(firstTwo, 2, readChecked, raw).run().match(
+    [](const String& err) { Serial.println("first 2 channels: " + err); },
+    [](size_t n) { Serial.println("first 2 channels ok: " + String((unsigned long)n) + " values"); }
+  );
+}
+
+// Before: one IO per element as a nested chain, depth = n (closures and stack frames)
+IO<int> nestedChain(const int* data, size_t i, size_t n, std::vector<int>* out) {
+  if (i == n) return IO<int>([]() { return 0; });
+  IO<int> head = readChannel(data[i]);
+  IO<int> rest = nestedChain(data, i + 1, n, out);
+  return IO<int>([head = std::move(head), rest = std::move(rest), out]() {
+    out->push_back(head.run());
+    return rest.run();
+  });
+}
+
+// Benchmark: build + run, nested chain vs. traverse (vector result / caller buffer)
+void benchmarkTraverse() {
+  const size_t maxNestedDepth = 10000;  // Deeper chains overflow an 8 MB host stack
+  for (size_t n : {10, 100, 1000, 10000, 100000}) {
+    std::vector<int> data(n);
+    for (size_t i = 0; i < n; ++i) data[i] = int(i % 16);
+    std::vector<int> out;
+    out.reserve(n);
+    const int runs = n <= 1000 ? 100 : 5;
+    volatile size_t sink = 0;
+    String line = "n=" + String((unsigned long)n) + ":";
+
+    if (n <= maxNestedDepth) {
+      unsigned long start = micros();
+      for (int r = 0; r < runs; ++r) {
+        out.clear();
+        nestedChain(data.data(), 0, n, &out).run();
+        sink = sink + out.size();
+      }
+      line += " nested " + String((micros() - start) * 1000.0f / (runs * n), 1) + " ns/elem,";
+    } else {
+      line += " nested (skipped, stack depth),";
+    }
+
+    unsigned long start = micros();
+    for (int r = 0; r < runs; ++r) sink = sink + traverse(data.data(), n, readChannel).run().size();
+    line += " traverse " + String((micros() - start) * 1000.0f / (runs * n), 1) + " ns/elem,";
+
+    out.resize(n);
+    start = micros();
+    for (int r = 0; r < runs; ++r) sink = sink + traverse(data.data(), n, readChannel, out.data()).run();
+    line += " into buffer " + String((micros() - start) * 1000.0f / (runs * n), 1) + " ns/elem";
+    Serial.println(line);
+  }
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testTraverse();
+  benchmarkTraverse();
+
+  delay(1000);
+}
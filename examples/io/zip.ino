@@ -0,0 +1,99 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <tuple> // Required for std::get
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+IO<float> readTemperature() {
+  return IO<float>([]() { return 20.0f + random(0, 50) / 10.0f; });
+}
+
+IO<float> readHumidity() {
+  return IO<float>([]() { return 40.0f + random(0, 200) / 10.0f; });
+}
+
+IO<int> readPressure() {
+  return IO<int>([]() { return 1000 + (int)random(0, 30); });
+}
+
+// Slow sensor: the read waits for the conversion (e.g. an I2C sensor)
+IO<int> readSlow(int id, unsigned long conversionUs) {
+  return IO<int>([=]() {
+    delayMicroseconds(conversionUs);
+    return id;
+  });
+}
+
+// expected output: zip: t=.. h=.. p=.. / mapN: dew point ~..
+void testZip() {
+  IO<std::tuple<float, float, int>> all = zip(readTemperature(), readHumidity(), readPressure());
+  std::tuple<float, float, int> r = all.run();
+  Serial.println("zip: t=" + String(std::get<0>(r)) + " h=" + String(std::get<1>(r))
+                 + " p=" + String(std::get<2>(r)));
+
+  IO<float> dewPoint = mapN([](float t, float h) { return t - (100.0f - h) / 5.0f; },
+                            readTemperature(), readHumidity());
+  Serial.println("mapN: dew point ~" + String(dewPoint.run()));
+}
+
+// Before: independent reads combined with nested flatMap
+IO<int> nestedSum(const IO<int>& a, const IO<int>& b, const IO<int>& c, const IO<int>& d) {
+  return IO<int>([=]() {
+    return a.flatMap([=](int x) {
+      return b.flatMap([=](int y) {
+        return c.flatMap([=](int z) {
+          return d.map([=](int w) { return x + y + z + w; });
+        });
+      });
+    }).run();
+  });
+}
+
+int sum4(int a, int b, int c, int d) { return a + b + c + d; }
+
+template<typename MakeIO>
+void timeRuns(const char* label, MakeIO make, int runs) {
+  volatile int sink = 0;
+  IO<int> io = make();
+  unsigned long start = micros();
+  for (int i = 0; i < runs; ++i) sink = sink + io.run();
+  unsigned long elapsed = micros() - start;
+  Serial.println(String(label) + String(elapsed / (float)runs, 2) + " us/run");
+}
+
+// Benchmark: 4 independent reads, nested flatMap vs. mapN (vs. mapNParallel on hosts)
+void benchmarkZip() {
+  IO<int> a = readPressure(), b = readPressure(), c = readPressure(), d = readPressure();
+  Serial.println("fast reads:");
+  timeRuns("  nested flatMap: ", [&]() { return nestedSum(a, b, c, d); }, 20000);
+  timeRuns("  mapN:           ", [&]() { return mapN(sum4, a, b, c, d); }, 20000);
+
+  const unsigned long conversionUs = 2000;
+  IO<int> s1 = readSlow(1, conversionUs), s2 = readSlow(2, conversionUs);
+  IO<int> s3 = readSlow(3, conversionUs), s4 = readSlow(4, conversionUs);
+  Serial.println("slow reads (4 x " + String(conversionUs) + " us):");
+  timeRuns("  nested flatMap: ", [&]() { return nestedSum(s1, s2, s3, s4); }, 20);
+  timeRuns("  mapN:           ", [&]() { return mapN(sum4, s1, s2, s3, s4); }, 20);
+#if defined(FUNCYCONTROLLERCPP_THREAD_POOL) && FUNCYCONTROLLERCPP_THREAD_POOL
+  static ThreadPool pool(4);
+  timeRuns("  mapNParallel:   ", [&]() { return mapNParallel(pool, sum4, s1, s2, s3, s4); }, 20);
+  timeRuns("  mapNParallel (fast reads): ", [&]() { return mapNParallel(pool, sum4, a, b, c, d); }, 2000);
+#endif
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testZip();
+  benchmarkZip();
+
+  delay(1000);
+}
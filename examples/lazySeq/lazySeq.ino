@@ -0,0 +1,122 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// findFirstEven() from basicMaybe.ino, but as a single lazy pass (no recursion)
+Maybe<int> findFirstEven(const std::vector<int>& numbers) {
+  return lazySeq(numbers).find([](int n) { return n % 2 == 0; });
+}
+
+// expected output: Found even number: 6; No even number found
+void testFindFirstEven() {
+  std::vector<int> numbers = {1, 3, 5, 6};
+  std::vector<int> numbersNothing = {1, 3, 5, 7};
+
+  findFirstEven(numbers).match(
+    [](int value) { Serial.println("Found even number: " + String(value)); },
+    []() { Serial.println("No even number found"); }
+  );
+  findFirstEven(numbersNothing).match(
+    [](int value) { Serial.println("Found even number: " + String(value)); },
+    []() { Serial.println("No even number found"); }
+  );
+}
+
+// map, filter, take, scan are fused: every sample is read at most once
+// expected output: Running sum: 4, 12, 24; head: Just 4; at(5): Nothing
+void testStages() {
+  int samples[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+  auto evensDoubled = lazySeq(samples)
+    .filter([](int v) { return v % 2 == 0; })
+    .map([](int v) { return v * 2; });
+
+  Serial.print("Running sum: ");
+  evensDoubled
+    .scan(0, [](int acc, int v) { return acc + v; })
+    .take(3)
+    .forEach([](int v) { Serial.print(String(v) + " "); });
+  Serial.println();
+
+  evensDoubled.head().match(
+    [](int v) { Serial.println("head: Just " + String(v)); },
+    []() { Serial.println("head: Nothing"); }
+  );
+  evensDoubled.at(5).match(
+    [](int v) { Serial.println("at(5): Just " + String(v)); },
+    []() { Serial.println("at(5): Nothing"); }
+  );
+}
+
+// foldEither(): stop the fold at the first invalid sample
+// expected output: Left: sample out of range: 900
+void testFoldEither() {
+  int samples[] = {10, 20, 900, 30};
+
+  lazySeq(samples)
+    .foldEither(0, [](int acc, int v) {
+      return (v < 500)
+        ? Either<int, String>::Right(acc + v)
+        : Either<int, String>::Left("sample out of range: " + String(v));
+    })
+    .match(
+      [](String err) { Serial.println("Left: " + err); },
+      [](int sum) { Serial.println("Right: " + String(sum)); }
+    );
+}
+
+// Benchmark: filter -> map -> fold, lazy vs. materializing std::vectors
+void benchmarkLazyVsVector() {
+  const size_t size = 4096;
+  const int rounds = 100;
+  std::vector<int> samples(size);
+  for (size_t i = 0; i < size; ++i) samples[i] = random(0, 1024);
+
+  volatile long sink = 0;
+
+  unsigned long start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    std::vector<int> filtered;
+    for (int v : samples) if (v > 100) filtered.push_back(v);
+    std::vector<int> scaled;
+    for (int v : filtered) scaled.push_back(v * 3);
+    long sum = 0;
+    for (int v : scaled) sum += v;
+    sink = sink + sum;
+  }
+  unsigned long vectorTime = micros() - start;
+
+  start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    sink = sink + lazySeq(samples)
+      .filter([](int v) { return v > 100; })
+      .map([](int v) { return v * 3; })
+      .fold(0L, [](long acc, int v) { return acc + v; });
+  }
+  unsigned long lazyTime = micros() - start;
+
+  Serial.println("filter/map/fold over " + String((unsigned long)size) + " samples x " + String(rounds));
+  Serial.println("  std::vector: " + String(vectorTime) + " us");
+  Serial.println("  LazySeq:     " + String(lazyTime) + " us");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testFindFirstEven();
+  testStages();
+  testFoldEither();
+  benchmarkLazyVsVector();
+
+  delay(1000);
+}
@@ -0,0 +1,113 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// expected output: Valid samples: 3; Sum: 6.00; Scaled[2]: 4.00; Filled[1]: -1.00
+void testMaybeArray() {
+  MaybeArray<float> samples(5);
+  samples.setJust(0, 1.0f);
+  samples.setJust(2, 2.0f);
+  samples.setJust(4, 3.0f);
+
+  Serial.println("Valid samples: " + String((unsigned long)samples.count()));
+  Serial.println("Sum: " + String(samples.fold(0.0f, [](float acc, float v) { return acc + v; })));
+
+  MaybeArray<float> scaled = samples.map([](float v) { return v * 2.0f; });
+  scaled.get(2).match(
+    [](float v) { Serial.println("Scaled[2]: " + String(v)); },
+    []() { Serial.println("Scaled[2]: Nothing"); }
+  );
+
+  MaybeArray<float> filled = samples.fillNothing(-1.0f);
+  filled.get(1).match(
+    [](float v) { Serial.println("Filled[1]: " + String(v)); },
+    []() { Serial.println("Filled[1]: Nothing"); }
+  );
+}
+
+// Benchmark: MaybeArray<float> vs. std::vector<Maybe<float>> (memory and throughput)
+void benchmarkMaybeArray() {
+  const size_t size = 4096;
+  const int rounds = 200;
+
+  std::vector<Maybe<float>> maybes;
+  maybes.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    // ~90% valid samples
+    maybes.push_back(random(0, 10) ? Maybe<float>::Just((float)random(0, 1000)) : Maybe<float>::Nothing());
+  }
+  MaybeArray<float> array = MaybeArray<float>::fromMaybes(maybes);
+
+  Serial.println("Memory for " + String((unsigned long)size) + " samples:");
+  Serial.println("  vector<Maybe<float>>: " + String((unsigned long)(size * sizeof(Maybe<float>))) + " bytes");
+  Serial.println("  MaybeArray<float>:    " + String((unsigned long)(size * sizeof(float) + (size + 63) / 64 * 8)) + " bytes");
+
+  volatile float sink = 0;
+
+  unsigned long start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    float sum = 0;
+    for (const Maybe<float>& m : maybes) sum += m.fold([](float v) { return v; }, []() { return 0.0f; });
+    sink = sink + sum;
+  }
+  unsigned long vectorFold = micros() - start;
+
+  start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    sink = sink + array.fold(0.0f, [](float acc, float v) { return acc + v; });
+  }
+  unsigned long arrayFold = micros() - start;
+
+  start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    std::vector<Maybe<float>> scaled;
+    scaled.reserve(size);
+    for (const Maybe<float>& m : maybes) scaled.push_back(m.map([](float v) { return v * 0.5f; }));
+    sink = sink + scaled.size();
+  }
+  unsigned long vectorMap = micros() - start;
+
+  start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    sink = sink + array.map([](float v) { return v * 0.5f; }).size();
+  }
+  unsigned long arrayMap = micros() - start;
+
+  start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    size_t n = 0;
+    for (const Maybe<float>& m : maybes) n += m.isJust();
+    sink = sink + n;
+  }
+  unsigned long vectorCount = micros() - start;
+
+  start = micros();
+  for (int r = 0; r < rounds; ++r) {
+    sink = sink + array.count();
+  }
+  unsigned long arrayCount = micros() - start;
+
+  Serial.println("x" + String(rounds) + "  vector<Maybe> / MaybeArray:");
+  Serial.println("  fold:  " + String(vectorFold) + " us / " + String(arrayFold) + " us");
+  Serial.println("  map:   " + String(vectorMap) + " us / " + String(arrayMap) + " us");
+  Serial.println("  count: " + String(vectorCount) + " us / " + String(arrayCount) + " us");
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testMaybeArray();
+  benchmarkMaybeArray();
+
+  delay(1000);
+}
@@ -0,0 +1,103 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Expensive pure transform: 7th order calibration polynomial with a log term
+float calibrate(int raw) {
+  const float x = raw / 4095.0f;
+  float y = 0;
+  const float c[] = {0.12f, -1.3f, 4.7f, -2.2f, 0.9f, 0.05f, -0.01f, 0.002f};
+  for (int i = 7; i >= 0; --i) y = y * x + c[i];
+  return y * 100.0f + 3.0f * log(1.0f + x);
+}
+
+// Config parsing: "key=value" -> value
+int parseValue(const String& entry) {
+  int eq = entry.indexOf('=');
+  return (eq < 0) ? -1 : entry.substring(eq + 1).toInt();
+}
+
+// Caches live next to the pipelines, not in loop()
+auto calibrateCached = memoize<64, true>(calibrate);
+auto parseCached = memoize<16>(parseValue);
+
+// Simulated ADC with few distinct values (slowly changing signal)
+IO<int> readAdc() {
+  return IO<int>([]() { return 2000 + (int)random(0, 20); });
+}
+
+// expected output: IO: ... / Maybe: ... / Either: ... / parsed: 42 42 / hits ~80 misses ~20
+void testMemoizeStages() {
+  for (int i = 0; i < 100; ++i) readAdc().map(stage(calibrateCached)).run();
+  Serial.println("IO: " + String(readAdc().map(stage(calibrateCached)).run()));
+
+  Maybe<int>::Just(1234).map(stage(calibrateCached)).match(
+    [](float v) { Serial.println("Maybe: " + String(v)); },
+    []() { Serial.println("Maybe: Nothing"); }
+  );
+  Either<int, String>::Right(2048).map(stage(calibrateCached)).match(
+    [](const String& e) { Serial.println("Either: " + e); },
+    [](float v) { Serial.println("Either: " + String(v)); }
+  );
+
+  int first = parseCached(String("threshold=42"));
+  int second = parseCached(String("threshold=42"));
+  Serial.println("parsed: " + String(first) + " " + String(second));
+  Serial.println("calibrate hits " + String((unsigned long)calibrateCached.hits())
+                 + " misses " + String((unsigned long)calibrateCached.misses()));
+}
+
+// Benchmark: ns/call, direct vs. memoize<64> over key pools of different sizes
+// (the fewer distinct keys, the higher the hit rate)
+template<typename Key, typename F, typename MakeKey>
+void benchmarkHitRate(F f, MakeKey makeKey, int distinctKeys) {
+  static auto cache = memoize<64, true>(f);
+  cache.clear();
+
+  std::vector<Key> keys(20000);
+  for (size_t i = 0; i < keys.size(); ++i) keys[i] = makeKey(random(0, distinctKeys));
+  volatile float sink = 0;
+
+  unsigned long start = micros();
+  for (const Key& k : keys) sink = sink + f(k);
+  unsigned long directTime = micros() - start;
+
+  start = micros();
+  for (const Key& k : keys) sink = sink + cache(k);
+  unsigned long cachedTime = micros() - start;
+
+  const float hitRate = 100.0f * cache.hits() / (cache.hits() + cache.misses());
+  Serial.println("  " + String(distinctKeys) + " keys: hit rate " + String(hitRate, 1) + " %, direct "
+                 + String(directTime * 1000.0f / keys.size(), 1) + " ns/call, memoized "
+                 + String(cachedTime * 1000.0f / keys.size(), 1) + " ns/call");
+}
+
+void benchmarkMemoize() {
+  Serial.println("memoize<64>(calibrate), 20000 calls:");
+  for (int distinctKeys : {16, 48, 64, 128, 512, 4096}) {
+    benchmarkHitRate<int>(calibrate, [](long k) { return int(k); }, distinctKeys);
+  }
+  Serial.println("memoize<64>(parseValue), 20000 calls:");
+  for (int distinctKeys : {16, 48, 64, 128, 512, 4096}) {
+    benchmarkHitRate<String>(parseValue, [](long k) { return String("sensor.threshold=") + String(k); }, distinctKeys);
+  }
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testMemoizeStages();
+  benchmarkMemoize();
+
+  delay(1000);
+}
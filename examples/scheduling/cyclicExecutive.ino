@@ -0,0 +1,158 @@
+#include <Arduino.h> // Requires Arduino framework context
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// IMU at 1 kHz, environment at 1 Hz, housekeeping at 0.1 Hz (periods in us)
+const unsigned long imuPeriod = 1000;
+const unsigned long envPeriod = 1000000;
+const unsigned long housekeepingPeriod = 10000000;
+
+// Checked at compile time
+static_assert(minorFrameOf(imuPeriod, envPeriod, housekeepingPeriod) == 1000, "minor frame: 1 ms");
+static_assert(majorFrameOf(imuPeriod, envPeriod, housekeepingPeriod) == 10000000, "major frame: 10 s");
+
+// ---------- Simulation on a virtual clock ----------
+// Tasks "take" time by advancing the virtual clock
+
+unsigned long virtualNow = 0;
+unsigned long virtualClock() { return virtualNow; }
+
+IO<void> simulatedTask(unsigned long minCost, unsigned long maxCost) {
+  return IO<void>([=]() { virtualNow += minCost + (unsigned long)random(0, maxCost - minCost + 1); });
+}
+
+// Environment read: 500-600 us, every 7th read hangs for 1.5 ms (sensor clock stretching)
+IO<void> simulatedEnvRead() {
+  return IO<void>([]() {
+    static int reads = 0;
+    virtualNow += (++reads % 7 == 0) ? 1500 : 500 + (unsigned long)random(0, 101);
+  });
+}
+
+void printGroup(CyclicExecutive<unsigned long (*)()>& executive, size_t group, const char* name) {
+  Serial.println(String("  ") + name + ": offset " + String(executive.frameOffset(group))
+                 + ", runs " + String(executive.runs(group))
+                 + ", utilization " + String(executive.utilization(group) * 100.0f, 2) + " %"
+                 + ", max " + String(executive.maxTime(group)) + " us"
+                 + ", overruns " + String(executive.overruns(group))
+                 + ", missed " + String(executive.missed(group)));
+}
+
+// Benchmark: 60 s of virtual time, 60000 minor frames
+void simulateExecutive() {
+  CyclicExecutive<unsigned long (*)()> executive(virtualClock);
+  size_t imu = executive.addGroup(imuPeriod).unwrapRight();
+  size_t env = executive.addGroup(envPeriod).unwrapRight();
+  size_t housekeeping = executive.addGroup(housekeepingPeriod).unwrapRight();
+  executive.addTask(imu, simulatedTask(120, 180));     // IMU read
+  executive.addTask(imu, simulatedTask(40, 60));       // Attitude filter
+  executive.addTask(env, simulatedEnvRead());
+  executive.addTask(housekeeping, simulatedTask(600, 700));
+  executive.addGroup(0).match(
+    [](ScheduleError) { Serial.println("addGroup(0): rejected (ZeroPeriod)"); },
+    [](size_t) { Serial.println("addGroup(0): accepted?"); }
+  );
+
+  executive.start().match(
+    [](ScheduleError) { Serial.println("start failed"); },
+    [](const FrameSchedule& s) {
+      Serial.println("schedule: minor frame " + String(s.minorFrame) + " us, major frame "
+                     + String(s.majorFrame) + " us, " + String(s.frames) + " frames");
+    }
+  );
+
+  virtualNow = 0;
+  const unsigned long simulated = 60000000;
+  while (virtualNow < simulated) {
+    if (!executive.poll()) virtualNow += executive.timeUntilNext();  // Idle until the next frame
+  }
+
+  Serial.println("60 s simulated:");
+  printGroup(executive, imu, "imu 1 kHz       ");
+  printGroup(executive, env, "env 1 Hz        ");
+  printGroup(executive, housekeeping, "housekeeping 0.1 Hz");
+  Serial.println("  total utilization " + String(executive.utilization() * 100.0f, 2) + " %, frame overruns "
+                 + String(executive.frameOverruns()) + ", skipped frames " + String(executive.skippedFrames()));
+  executive.lastOverrun().match(
+    [](const OverrunReport& r) {
+      Serial.println("  last overrun: frame " + String(r.frame) + ", group " + String((unsigned long)r.group)
+                     + ", frame work " + String(r.frameTime) + " us");
+    },
+    []() { Serial.println("  no overruns"); }
+  );
+}
+
+// 80 min of a 32-bit micros clock: it wraps after 71.6 min (2^32 us), utilization must not
+// expected output: 80 min on a 32-bit clock: utilization 25.00 %, 4800 runs
+uint32_t wrapNow = 0;
+uint32_t wrapClock() { return wrapNow; }
+
+void simulateClockWrap() {
+  CyclicExecutive<uint32_t (*)()> executive(wrapClock);
+  size_t second = executive.addGroup(1000000).unwrapRight();                 // 1 Hz
+  executive.addTask(second, IO<void>([]() { wrapNow += 250000; }));         // 250 ms of work
+  executive.start();
+
+  wrapNow = 0;
+  for (unsigned long frames = 0; frames < 4800;) {
+    if (executive.poll()) ++frames;
+    else wrapNow += executive.timeUntilNext();
+  }
+  Serial.println("80 min on a 32-bit clock: utilization " + String(executive.utilization() * 100.0f, 2)
+                 + " %, " + String(executive.runs(second)) + " runs");
+}
+
+// Benchmark: dispatch overhead per minor frame on the host clock
+// (empty tasks, the virtual clock steps one minor frame per poll)
+void benchmarkDispatch() {
+  CyclicExecutive<unsigned long (*)()> executive(virtualClock);
+  IO<void> noop = IO<void>([]() {});
+  for (unsigned long period : {1000UL, 10000UL, 100000UL, 1000000UL}) {
+    executive.addTask(executive.addGroup(period).unwrapRight(), noop);
+  }
+  executive.start();
+
+  const long frames = 200000;
+  unsigned long start = micros();
+  for (long i = 0; i < frames; ++i) {
+    virtualNow += 1000;
+    executive.poll();
+  }
+  unsigned long elapsed = micros() - start;
+  Serial.println("dispatch, 4 groups: " + String(elapsed * 1000.0f / frames, 1) + " ns/frame, skipped frames "
+                 + String(executive.skippedFrames()));
+}
+
+// ---------- Real time ----------
+CyclicExecutive<> blinker;
+unsigned long fastCount = 0;
+
+void setupBlinker() {
+  size_t fast = blinker.addGroup(10000).unwrapRight();     // 100 Hz
+  size_t report = blinker.addGroup(1000000).unwrapRight(); // 1 Hz
+  blinker.addTask(fast, IO<void>([]() { ++fastCount; }));
+  blinker.addTask(report, IO<void>([]() {
+    Serial.println("100 Hz task ran " + String(fastCount) + " times, utilization "
+                   + String(blinker.utilization() * 100.0f, 3) + " %");
+  }));
+  blinker.start();
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+  simulateExecutive();
+  simulateClockWrap();
+  benchmarkDispatch();
+  setupBlinker();
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  blinker.poll();   // No delay(): the executive paces all groups
+}
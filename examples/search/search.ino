@@ -0,0 +1,97 @@
+#include <Arduino.h> // Requires Arduino framework context
+#include <vector> // Required for std::vector
+
+// My functional programming lib
+#include <FuncyControllerCPP.hpp> // Include the main library header
+using namespace funcy_controller_cpp; // Use the library's namespace to avoid qualifying every type
+
+// Largest buffer used in the benchmark (the host can do a lot more than a uC)
+#ifndef SEARCH_BENCH_MAX_BYTES
+#if defined(__x86_64__) || defined(__i386__)
+#define SEARCH_BENCH_MAX_BYTES (64UL * 1024 * 1024)
+#else
+#define SEARCH_BENCH_MAX_BYTES (16UL * 1024)
+#endif
+#endif
+
+// expected output: First over threshold: 812 at index 3; Last over threshold: 990; Error code 7: Nothing
+void testSearch() {
+  std::vector<int32_t> samples = {12, 400, 650, 812, 33, 990, 5};
+  std::vector<int32_t> errorCodes = {0, 0, 3, 0};
+
+  findFirst(samples, greaterThan(700)).match(
+    [](int32_t v) { Serial.print("First over threshold: " + String((long)v)); },
+    []() { Serial.print("First over threshold: Nothing"); }
+  );
+  findFirstIndex(samples, greaterThan(700)).match(
+    [](size_t i) { Serial.println(" at index " + String((unsigned long)i)); },
+    []() { Serial.println(); }
+  );
+
+  findLast(samples, greaterThan(700)).match(
+    [](int32_t v) { Serial.println("Last over threshold: " + String((long)v)); },
+    []() { Serial.println("Last over threshold: Nothing"); }
+  );
+
+  indexOf(errorCodes, 7).match(
+    [](size_t i) { Serial.println("Error code 7 at index " + String((unsigned long)i)); },
+    []() { Serial.println("Error code 7: Nothing"); }
+  );
+
+  // Any callable works too (scalar loop), e.g. findFirstEven() from basicMaybe.ino
+  findFirst(samples, [](int32_t v) { return v % 2 == 0; }).match(
+    [](int32_t v) { Serial.println("First even: " + String((long)v)); },
+    []() { Serial.println("First even: Nothing"); }
+  );
+}
+
+// Benchmark: first float sample over threshold, match placed at the very end,
+// kernel (SIMD on x86) vs. a plain scalar loop with a lambda
+// (x86-64 g++ -O2, 1 MB: SSE2 20600 vs scalar 6500 MB/s, -mavx2 38000 MB/s;
+//  64 MB: about 7000 vs 4800 MB/s, memory bound)
+void benchmarkSearch() {
+  Serial.println("findFirstIndex(greaterThan) throughput, float buffers:");
+  for (size_t bytes = 1024; bytes <= SEARCH_BENCH_MAX_BYTES; bytes *= 4) {
+    const size_t size = bytes / sizeof(float);
+    std::vector<float> samples(size, 1.0f);
+    samples[size - 1] = 100.0f;
+    const int rounds = (int)((64UL * 1024 * 1024) / bytes / 4) + 1;
+
+    volatile size_t sink = 0;
+    unsigned long start = micros();
+    for (int r = 0; r < rounds; ++r) {
+      sink = sink + findFirstIndex(samples, greaterThan(50.0f)).fold(
+        [](size_t i) { return i; }, []() { return size_t(0); });
+    }
+    unsigned long kernelTime = micros() - start;
+
+    start = micros();
+    for (int r = 0; r < rounds; ++r) {
+      sink = sink + findFirstIndex(samples, [](float v) { return v > 50.0f; }).fold(
+        [](size_t i) { return i; }, []() { return size_t(0); });
+    }
+    unsigned long scalarTime = micros() - start;
+
+    // MB/s = bytes * rounds / us
+    float kernelMBs = (float)bytes * rounds / (kernelTime ? kernelTime : 1);
+    float scalarMBs = (float)bytes * rounds / (scalarTime ? scalarTime : 1);
+    Serial.println("  " + String((unsigned long)(bytes / 1024)) + " KB: kernel " + String(kernelMBs, 0)
+                   + " MB/s, scalar " + String(scalarMBs, 0) + " MB/s");
+  }
+}
+
+void setup() {
+  // put your setup code here, to run once:
+  Serial.begin(115200);
+  delay(100);
+
+}
+
+void loop() {
+  // put your main code here, to run repeatedly:
+
+  testSearch();
+  benchmarkSearch();
+
+  delay(1000);
+}
@@ -0,0 +1,48 @@
+#!/bin/sh
+# Build-time benchmark for the extern template packs (src/Instantiations.hpp).
+# Compiles every example with and without FUNCYCONTROLLERCPP_EXTERN_TEMPLATES
+# and prints compile time and program size per example and in total.
+#
+# Usage: extras/benchmarks/instantiation_bench.sh [fqbn]
+#   fqbn defaults to esp32:esp32:esp32 (needs arduino-cli and the core installed)
+
+FQBN=${1:-esp32:esp32:esp32}
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+FLAG="-DFUNCYCONTROLLERCPP_EXTERN_TEMPLATES"
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+now_ms() { date +%s%3N; }
+
+run() {
+  label=$1
+  props=$2
+  total_ms=0
+  total_bytes=0
+  for sketch in $(find "$ROOT/examples" -name '*.ino' | sort); do
+    # Some example folders hold several sketches: build each in its own folder
+    name=$(basename "$sketch" .ino)
+    dir="$WORK/$name"
+    mkdir -p "$dir" && cp "$sketch" "$dir/$name.ino"
+    start=$(now_ms)
+    out=$(arduino-cli compile --clean --fqbn "$FQBN" --library "$ROOT" \
+          ${props:+--build-property "compiler.cpp.extra_flags=$props"} \
+          "$dir" 2>&1)
+    status=$?
+    ms=$(( $(now_ms) - start ))
+    bytes=$(echo "$out" | sed -n 's/^Sketch uses \([0-9]*\) bytes.*/\1/p')
+    if [ $status -ne 0 ] || [ -z "$bytes" ]; then
+      echo "  $label $(basename "$sketch"): build failed"
+      continue
+    fi
+    echo "  $label $(basename "$sketch"): ${ms} ms, ${bytes} bytes"
+    total_ms=$((total_ms + ms))
+    total_bytes=$((total_bytes + bytes))
+  done
+  echo "$label total: ${total_ms} ms, ${total_bytes} bytes"
+}
+
+echo "FQBN: $FQBN"
+run "header-only  " ""
+run "extern packs " "$FLAG"
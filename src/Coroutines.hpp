@@ -0,0 +1,239 @@
+// ==================== co_await for Maybe<T> and Either<T, E> ====================
+// Concept:
+//  - Do-notation with C++20 coroutines: a function returning Maybe<T> or
+//    Either<T, E> can co_await intermediate Maybe / Either values.
+//  - co_await on Just / Right yields the value and continues.
+//  - co_await on Nothing / Left ends the function right there and returns
+//    Nothing / that Left (like a flatMap chain, but flat).
+//  - co_return value; returns Just(value) / Right(value).
+// Example:
+//  Maybe<int> sum(Maybe<int> a, Maybe<int> b) {
+//    int x = co_await a;
+//    int y = co_await b;
+//    co_return x + y;
+//  }
+// Memory:
+//  - Coroutine frames never use the heap. They run to completion before the
+//    function returns, so they are strictly nested and live in a small
+//    per-thread stack arena (FUNCYCONTROLLERCPP_COROUTINE_ARENA_SIZE bytes).
+//  - The arena bounds the nesting depth: coroutine calls active at the same time
+//    (a coroutine that calls a coroutine, recursion) each hold one frame.
+//    Frames are rounded up to alignof(max_align_t); their size is up to the
+//    compiler (x86-64 g++: 80 / 96 bytes for a small recursive Maybe<int> /
+//    Either<int, int> function, so the default 1024 bytes hold 10 to 12 nested
+//    frames; 32-bit targets need less). Check the
+//    real need with coroutineArenaPeak() and size the arena with
+//    FUNCYCONTROLLERCPP_COROUTINE_ARENA_SIZE.
+//  - A frame that does not fit is a fatal error, never a Nothing / Left:
+//    FUNCYCONTROLLERCPP_COROUTINE_ARENA_OVERFLOW() runs (default std::terminate(),
+//    define it to log or halt first; it must not return).
+// Note:
+//  - co_await is slower and larger than the flatMap chain it replaces: each call
+//    sets up a frame in the arena and resumes it through an out-of-line actor
+//    function, which g++ does not inline. x86-64 g++ 12, examples/maybe/coroutineDo.ino:
+//      Maybe<int>, 2 steps:            -O2 about 5x slower, 825 vs 75 bytes
+//                                      -Os about 2.3x slower, 581 vs 64 bytes
+//      Either<int, String>, 3 steps:   -O2 about 1.3x slower, 2450 vs 1838 bytes
+//                                      -Os about 2x slower, 1138 vs 384 bytes
+//    Use it where readability matters more than a few hundred ns per call;
+//    keep flatMap in tight loops.
+// Requirements:
+//  - C++20 coroutines (e.g. -std=gnu++20). Without them this header is empty.
+
+#ifndef FUNCYCONTROLLERCPP_COROUTINES_HPP
+#define FUNCYCONTROLLERCPP_COROUTINES_HPP
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define FUNCYCONTROLLERCPP_HAS_COROUTINES 1
+#endif
+#endif
+
+#if defined(FUNCYCONTROLLERCPP_HAS_COROUTINES)
+
+#include <coroutine>    // For std::coroutine_traits, std::coroutine_handle
+#include <cstddef>      // For size_t, std::max_align_t
+#include <exception>    // For std::terminate
+#include "Maybe.hpp"
+#include "Either.hpp"
+
+#ifndef FUNCYCONTROLLERCPP_COROUTINE_ARENA_SIZE
+#define FUNCYCONTROLLERCPP_COROUTINE_ARENA_SIZE 1024
+#endif
+
+#ifndef FUNCYCONTROLLERCPP_COROUTINE_ARENA_OVERFLOW
+#define FUNCYCONTROLLERCPP_COROUTINE_ARENA_OVERFLOW() std::terminate()
+#endif
+
+namespace funcy_controller_cpp {
+
+namespace detail {
+
+// Stack arena for coroutine frames (frames are strictly nested: LIFO)
+struct CoroutineArena {
+  static constexpr size_t Align = alignof(std::max_align_t);
+
+  alignas(Align) unsigned char buffer[FUNCYCONTROLLERCPP_COROUTINE_ARENA_SIZE];
+  size_t top = 0;
+  size_t peak = 0;   // Highest top seen
+
+  static CoroutineArena& instance() {
+    static thread_local CoroutineArena arena;
+    return arena;
+  }
+
+  void* allocate(size_t size) {
+    size = (size + Align - 1) / Align * Align;
+    if (size > sizeof(buffer) - top) {
+      FUNCYCONTROLLERCPP_COROUTINE_ARENA_OVERFLOW();   // Does not return
+    }
+    void* p = buffer + top;
+    top += size;
+    if (top > peak) peak = top;
+    return p;
+  }
+
+  void deallocate(void* p) {
+    // LIFO: the frame being freed is always the top one
+    top = static_cast<unsigned char*>(p) - buffer;
+  }
+};
+
+template<typename R> struct CoroutineResult;
+
+// Common promise part: frame allocation, eager start, no suspension at the end
+template<typename R>
+struct CoroutinePromise {
+  // Where the result goes (see CoroutineResult)
+  R* out = nullptr;
+  CoroutineResult<R>* result = nullptr;
+
+  ~CoroutinePromise();
+
+  // Never returns nullptr (overflow does not return), so there is no
+  // get_return_object_on_allocation_failure: no made-up Nothing / Left
+  static void* operator new(size_t size) {
+    return CoroutineArena::instance().allocate(size);
+  }
+  static void operator delete(void* p) noexcept {
+    CoroutineArena::instance().deallocate(p);
+  }
+
+  std::suspend_never initial_suspend() const noexcept { return {}; }
+  std::suspend_never final_suspend() const noexcept { return {}; }
+  void unhandled_exception() const noexcept { std::terminate(); }
+};
+
+// Returned by get_return_object() and converted into the real return type R.
+// Compilers do this conversion either before the body runs (then the result
+// is redirected into the converted R, see redirect()) or when the coroutine
+// returns to the caller (then the result already sits in value).
+template<typename R>
+struct CoroutineResult {
+  R value;
+  CoroutinePromise<R>* promise = nullptr;  // nullptr once the frame is gone
+
+  CoroutineResult(CoroutinePromise<R>* p, R initial) : value(initial), promise(p) {
+    promise->out = &value;
+    promise->result = this;
+  }
+  CoroutineResult(const CoroutineResult&) = delete;
+
+  ~CoroutineResult() {
+    if (promise) promise->result = nullptr;
+  }
+
+  // Called by the converting constructor of Maybe / Either
+  void redirect(R* target) {
+    if (promise) promise->out = target;
+  }
+};
+
+template<typename R>
+CoroutinePromise<R>::~CoroutinePromise() {
+  if (result) result->promise = nullptr;
+}
+
+// ---------- Maybe ----------
+
+template<typename T>
+struct MaybePromise : CoroutinePromise<Maybe<T>> {
+  CoroutineResult<Maybe<T>> get_return_object() { return {this, Maybe<T>::Nothing()}; }
+
+  void return_value(T value) { *this->out = Maybe<T>::Just(value); }
+
+  template<typename U>
+  struct Awaiter {
+    Maybe<U> maybe;
+
+    bool await_ready() const { return maybe.isJust(); }
+    // Nothing: *out is already Nothing, just drop the frame
+    void await_suspend(std::coroutine_handle<> h) const { h.destroy(); }
+    U await_resume() const { return maybe.fold([](U v) { return v; }, []() { return U(); }); }
+  };
+
+  template<typename U>
+  Awaiter<U> await_transform(Maybe<U> maybe) const { return {maybe}; }
+};
+
+// ---------- Either ----------
+
+template<typename T, typename E>
+struct EitherPromise : CoroutinePromise<Either<T, E>> {
+  // Placeholder only: the body always overwrites it (co_return or a co_awaited Left)
+  CoroutineResult<Either<T, E>> get_return_object() { return {this, Either<T, E>::Left(E())}; }
+
+  void return_value(T value) { *this->out = Either<T, E>::Right(value); }
+
+  template<typename U>
+  struct Awaiter {
+    Either<U, E> either;
+
+    bool await_ready() const { return either.isRight(); }
+    // Left: return it and drop the frame (this awaiter lives in the frame!)
+    void await_suspend(std::coroutine_handle<EitherPromise> h) const {
+      *h.promise().out = Either<T, E>::Left(either.unwrapLeft());
+      h.destroy();
+    }
+    U await_resume() const { return either.unwrapRight(); }
+  };
+
+  template<typename U>
+  Awaiter<U> await_transform(Either<U, E> either) const { return {either}; }
+};
+
+} // namespace detail
+
+// Converting constructors declared in Maybe.hpp / Either.hpp
+template<typename T>
+Maybe<T>::Maybe(detail::CoroutineResult<Maybe<T>>&& result) : Maybe(result.value) {
+  result.redirect(this);
+}
+
+template<typename T, typename E>
+Either<T, E>::Either(detail::CoroutineResult<Either<T, E>>&& result) : Either(result.value) {
+  result.redirect(this);
+}
+
+// Most arena bytes in use at once so far (this thread), to size
+// FUNCYCONTROLLERCPP_COROUTINE_ARENA_SIZE
+inline size_t coroutineArenaPeak() {
+  return detail::CoroutineArena::instance().peak;
+}
+
+} // namespace funcy_controller_cpp
+
+// Tell the compiler which promise to use for functions returning Maybe / Either
+template<typename T, typename... Args>
+struct std::coroutine_traits<funcy_controller_cpp::Maybe<T>, Args...> {
+  using promise_type = funcy_controller_cpp::detail::MaybePromise<T>;
+};
+
+template<typename T, typename E, typename... Args>
+struct std::coroutine_traits<funcy_controller_cpp::Either<T, E>, Args...> {
+  using promise_type = funcy_controller_cpp::detail::EitherPromise<T, E>;
+};
+
+#endif // FUNCYCONTROLLERCPP_HAS_COROUTINES
+
+#endif // FUNCYCONTROLLERCPP_COROUTINES_HPP
@@ -0,0 +1,339 @@
+// ==================== CyclicExecutive<Clock> ====================
+// Concept:
+//  - Multi-rate polling without hand-timed chains: IO tasks are registered into
+//    rate groups (one period per group), start() computes a static schedule:
+//      minor frame = gcd of all group periods (the tick)
+//      major frame = lcm of all group periods (the schedule repeats after it)
+//    Each group runs every period / minor frames. Slower groups get different frame
+//    offsets, so they do not pile up in the same minor frame.
+//  - poll() is non-blocking: call it from loop(). When a minor frame is due (absolute
+//    deadlines, no drift) it runs the due groups, fastest first (rate monotonic).
+//  - Built-in readouts:
+//      overruns(group)    - frames whose work did not fit into the minor frame,
+//                           charged to the group that crossed the frame end
+//      missed(group)      - group runs lost in frames skipped after an overrun
+//      utilization(group) - share of the elapsed time spent in the group (0..1)
+//                           (64-bit sums, valid across clock wrap-around)
+//      maxTime(group)     - longest run of the group seen (clock units)
+// Usage:
+//  CyclicExecutive<> executive;                        // micros(), global / static
+//  size_t imu = executive.addGroup(1000).unwrapRight();  // 1 kHz (Left only for period 0)
+//  executive.addTask(imu, readImu);
+//  ... addGroup(1000000) (1 Hz), addGroup(10000000) (0.1 Hz), addTask ...
+//  executive.start();                                  // Either<FrameSchedule, ScheduleError>
+//  void loop() { executive.poll(); }
+// Note:
+//  - Periods are in the unit of the clock (default micros). Any callable works, e.g. a
+//    virtual clock in simulations (see examples/scheduling). Time arithmetic uses the
+//    clock's return type, so a 32-bit clock wraps like micros() on AVR.
+//  - Busy and elapsed time are summed in uint64_t, the elapsed time frame by frame:
+//    utilization stays right after the clock wraps (micros: 71.6 min on 32 bit),
+//    as long as poll() runs at least once per wrap period.
+//  - minorFrameOf / majorFrameOf are constexpr, to check a set of periods at compile time.
+//  - Registration allocates (std::vector), polling does not.
+
+#ifndef FUNCYCONTROLLERCPP_CYCLICEXECUTIVE_HPP
+#define FUNCYCONTROLLERCPP_CYCLICEXECUTIVE_HPP
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For uint8_t, uint32_t, uint64_t
+#include <type_traits>  // For std::decay_t
+#include <utility>      // For std::declval
+#include <vector>       // Groups and tasks
+#include "Maybe.hpp"    // lastOverrun()
+#include "Either.hpp"   // Registration results
+#include "IO.hpp"       // Tasks
+
+namespace funcy_controller_cpp {
+
+enum class ScheduleError : uint8_t {
+  ZeroPeriod,         // A group period of 0
+  NoSuchGroup,        // addTask with an unknown group id
+  NoGroups,           // start() without groups
+  MajorFrameOverflow, // lcm of the periods does not fit into unsigned long
+  AlreadyStarted      // Registration after start()
+};
+
+struct FrameSchedule {
+  unsigned long minorFrame = 0;
+  unsigned long majorFrame = 0;
+  unsigned long frames = 0;     // Minor frames per major frame
+};
+
+struct OverrunReport {
+  unsigned long frame = 0;      // Minor frame index within the major frame
+  size_t group = 0;             // Group that crossed the end of the frame
+  unsigned long frameTime = 0;  // Work time of the frame (clock units)
+};
+
+// ==================== Frame arithmetic (constexpr) ====================
+constexpr unsigned long gcdOf(unsigned long a, unsigned long b) {
+  return b == 0 ? a : gcdOf(b, a % b);
+}
+
+// 0 on overflow
+constexpr unsigned long lcmOf(unsigned long a, unsigned long b) {
+  return (a == 0 || b == 0) ? 0
+       : (a / gcdOf(a, b) > ~0UL / b) ? 0
+       : a / gcdOf(a, b) * b;
+}
+
+template<typename... P>
+constexpr unsigned long minorFrameOf(unsigned long first, P... rest) {
+  unsigned long g = first;
+  ((g = gcdOf(g, rest)), ...);
+  return g;
+}
+
+template<typename... P>
+constexpr unsigned long majorFrameOf(unsigned long first, P... rest) {
+  unsigned long l = first;
+  ((l = lcmOf(l, rest)), ...);
+  return l;
+}
+
+// ==================== CyclicExecutive ====================
+template<typename Clock = unsigned long (*)()>
+class CyclicExecutive {
+public:
+  using GroupResult = Either<size_t, ScheduleError>;
+  using StartResult = Either<FrameSchedule, ScheduleError>;
+  using Time = std::decay_t<decltype(std::declval<Clock&>()())>;   // Unsigned, wraps
+
+  explicit CyclicExecutive(Clock clock = micros) : clock(clock) {}
+
+  // New rate group, Right(group id)
+  GroupResult addGroup(unsigned long period) {
+    if (started) return GroupResult::Left(ScheduleError::AlreadyStarted);
+    if (period == 0) return GroupResult::Left(ScheduleError::ZeroPeriod);
+    Group g;
+    g.period = period;
+    groups.push_back(g);
+    return GroupResult::Right(groups.size() - 1);
+  }
+
+  // Task in group, Right(task id); tasks of a group run in registration order
+  GroupResult addTask(size_t group, const IO<void>& task) {
+    if (started) return GroupResult::Left(ScheduleError::AlreadyStarted);
+    if (group >= groups.size()) return GroupResult::Left(ScheduleError::NoSuchGroup);
+    pending.push_back(PendingTask{group, task});
+    return GroupResult::Right(pending.size() - 1);
+  }
+
+  // Tasks with a result: the result is discarded
+  template<typename T>
+  GroupResult addTask(size_t group, const IO<T>& task) {
+    return addTask(group, IO<void>([task]() { task.run(); }));
+  }
+
+  // Computes the schedule, the first poll() starts frame 0
+  StartResult start() {
+    if (started) return StartResult::Left(ScheduleError::AlreadyStarted);
+    if (groups.empty()) return StartResult::Left(ScheduleError::NoGroups);
+
+    unsigned long minor = groups[0].period, major = groups[0].period;
+    for (const Group& g : groups) {
+      minor = gcdOf(minor, g.period);
+      major = lcmOf(major, g.period);
+      if (major == 0) return StartResult::Left(ScheduleError::MajorFrameOverflow);
+    }
+    frameSchedule.minorFrame = minor;
+    frameSchedule.majorFrame = major;
+    frameSchedule.frames = major / minor;
+
+    // Rate monotonic order, slower groups staggered over the minor frames
+    order.clear();
+    for (size_t i = 0; i < groups.size(); ++i) order.push_back(i);
+    for (size_t i = 1; i < order.size(); ++i) {
+      for (size_t j = i; j > 0 && groups[order[j]].period < groups[order[j - 1]].period; --j) {
+        const size_t t = order[j];
+        order[j] = order[j - 1];
+        order[j - 1] = t;
+      }
+    }
+    unsigned long nextOffset = 0;
+    for (size_t i : order) {
+      Group& g = groups[i];
+      g.every = g.period / minor;
+      g.offset = (g.every == 1) ? 0 : nextOffset++ % g.every;
+    }
+
+    // Tasks contiguous per group
+    tasks.clear();
+    tasks.reserve(pending.size());
+    for (size_t i : order) {
+      groups[i].firstTask = tasks.size();
+      for (const PendingTask& p : pending) {
+        if (p.group == i) tasks.push_back(p.task);
+      }
+      groups[i].taskCount = tasks.size() - groups[i].firstTask;
+    }
+    pending.clear();
+    pending.shrink_to_fit();
+
+    started = true;
+    running = false;
+    return StartResult::Right(frameSchedule);
+  }
+
+  // Runs the due minor frame (if any), true if a frame ran
+  bool poll() {
+    if (!started) return false;
+    Time now = clock();
+    if (!running) {
+      running = true;
+      deadline = now;
+      lastSeen = now;
+      elapsed = 0;
+      frame = 0;
+    }
+    advance(now);
+    const Time lateness = now - deadline;
+    if (lateness > maxLateness()) return false;  // Next frame still ahead
+
+    // Missed whole frames: skip them, keep the schedule aligned
+    const Time minor = Time(frameSchedule.minorFrame);
+    if (lateness >= minor) {
+      const Time skip = lateness / minor;
+      for (Group& g : groups) g.missed += dueCount(g, frame, skip);
+      skippedFrameCount += uint32_t(skip);
+      frame = (frame + skip) % frameSchedule.frames;
+      deadline += skip * minor;
+    }
+
+    // Run the due groups, fastest first
+    const Time frameStart = now;
+    bool overrun = false;
+    for (size_t i : order) {
+      Group& g = groups[i];
+      if (frame % g.every != g.offset) continue;
+      for (size_t t = g.firstTask; t < g.firstTask + g.taskCount; ++t) tasks[t].run();
+      const Time end = clock();
+      const Time spent = end - now;
+      now = end;
+      g.busy += spent;
+      if (spent > g.maxTime) g.maxTime = spent;
+      ++g.runs;
+      if (!overrun && Time(end - deadline) > minor) {
+        overrun = true;
+        ++g.overruns;
+        ++frameOverrunCount;
+        last = OverrunReport{frame, i, Time(end - frameStart)};
+        hasOverrun = true;
+      }
+    }
+
+    advance(now);
+    deadline += minor;
+    frame = (frame + 1 == frameSchedule.frames) ? 0 : frame + 1;
+    return true;
+  }
+
+  // Time until the next minor frame (0 if due), e.g. for a sleep
+  unsigned long timeUntilNext() const {
+    if (!running) return 0;
+    const Time now = clock();
+    return Time(now - deadline) > maxLateness() ? Time(deadline - now) : 0;
+  }
+
+  const FrameSchedule& schedule() const { return frameSchedule; }
+  size_t groupCount() const { return groups.size(); }
+  unsigned long period(size_t group) const { return groups[group].period; }
+  unsigned long frameOffset(size_t group) const { return groups[group].offset; }
+
+  uint32_t runs(size_t group) const { return groups[group].runs; }
+  uint32_t overruns(size_t group) const { return groups[group].overruns; }
+  uint32_t missed(size_t group) const { return groups[group].missed; }
+  unsigned long maxTime(size_t group) const { return groups[group].maxTime; }
+  uint32_t frameOverruns() const { return frameOverrunCount; }
+  uint32_t skippedFrames() const { return skippedFrameCount; }
+
+  Maybe<OverrunReport> lastOverrun() const {
+    return hasOverrun ? Maybe<OverrunReport>::Just(last) : Maybe<OverrunReport>::Nothing();
+  }
+
+  // Share of the time since the first poll (or resetStats) spent in group
+  float utilization(size_t group) const {
+    return share(groups[group].busy);
+  }
+
+  // All groups together
+  float utilization() const {
+    uint64_t busy = 0;
+    for (const Group& g : groups) busy += g.busy;
+    return share(busy);
+  }
+
+  void resetStats() {
+    for (Group& g : groups) {
+      g.busy = g.maxTime = 0;
+      g.runs = g.overruns = g.missed = 0;
+    }
+    frameOverrunCount = skippedFrameCount = 0;
+    hasOverrun = false;
+    lastSeen = clock();
+    elapsed = 0;
+  }
+
+private:
+  struct Group {
+    unsigned long period = 0;
+    unsigned long every = 1;    // Runs every `every` minor frames ...
+    unsigned long offset = 0;   // ... in frames with frame % every == offset
+    size_t firstTask = 0;
+    size_t taskCount = 0;
+    uint64_t busy = 0;          // Clock units, does not wrap
+    Time maxTime = 0;
+    uint32_t runs = 0;
+    uint32_t overruns = 0;
+    uint32_t missed = 0;
+  };
+
+  struct PendingTask {
+    size_t group;
+    IO<void> task;
+  };
+
+  Clock clock;
+  std::vector<Group> groups;
+  std::vector<size_t> order;          // Group ids, fastest first
+  std::vector<IO<void>> tasks;        // Contiguous per group (after start)
+  std::vector<PendingTask> pending;   // Before start
+  FrameSchedule frameSchedule;
+  bool started = false;
+  bool running = false;
+  Time deadline = 0;
+  Time lastSeen = 0;           // Clock at the last elapsed update
+  uint64_t elapsed = 0;        // Since the first poll / resetStats, summed per frame
+  unsigned long frame = 0;
+  uint32_t frameOverrunCount = 0;
+  uint32_t skippedFrameCount = 0;
+  OverrunReport last;
+  bool hasOverrun = false;
+
+  // now - deadline above this: the deadline is in the future (difference wrapped)
+  static constexpr Time maxLateness() { return Time(~Time(0)) / 2; }
+
+  // Adds the time since the last update (one frame at most, so it cannot wrap)
+  void advance(Time now) {
+    elapsed += Time(now - lastSeen);
+    lastSeen = now;
+  }
+
+  float share(uint64_t busy) const {
+    if (!running) return 0.0f;
+    const uint64_t total = elapsed + Time(clock() - lastSeen);
+    return total == 0 ? 0.0f : float(busy) / float(total);
+  }
+
+  // Runs of g due in the count frames starting at frame `from` (cyclic)
+  uint32_t dueCount(const Group& g, unsigned long from, unsigned long count) const {
+    // First frame >= from with frame % every == offset
+    const unsigned long phase = (g.offset + g.every - from % g.every) % g.every;
+    return phase >= count ? 0 : uint32_t((count - phase - 1) / g.every + 1);
+  }
+};
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_CYCLICEXECUTIVE_HPP
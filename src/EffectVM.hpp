@@ -0,0 +1,377 @@
+// ==================== EffectVM<T> / EffectProgram ====================
+// Concept:
+//  - Optional data representation of IO / Either pipelines: a program is a few bytes
+//    of bytecode, run by one small register VM. Many similar pipelines then share
+//    one interpreter and one set of functions instead of one template instantiation
+//    (and one set of lambdas) per chain. Programs can be stored, sent and inspected
+//    at runtime, and run over a whole batch of inputs.
+//  - Values are T (one type per VM), errors are uint8_t codes: a register state is
+//    Right(value) or Left(code), like Either<T, uint8_t>.
+//  - Functions are plain function pointers registered with the VM, the program
+//    refers to them by id (registration order, per kind).
+//  - Opcodes (8 registers r0..r7):
+//      input dst              r[dst] = run input
+//      constant dst, value    r[dst] = value
+//      move dst, src          r[dst] = r[src]
+//      effect dst, fn         r[dst] = effects[fn]()            (call registered effect)
+//      map dst, src, fn       r[dst] = maps[fn](r[src])
+//      map2 dst, a, b, fn     r[dst] = maps2[fn](r[a], r[b])
+//      bind dst, src, fn      binds[fn](r[src]): Right -> r[dst], Left -> Left state
+//      branchLeft label       jump if Left
+//      jump label             jump
+//      recover                Left -> Right again (e.g. before loading a fallback)
+//      fail code              Left(code), code 1..254
+//      ret src                result: Right(r[src]) or Left(code)
+//    While Left, the value instructions (input .. bind) are skipped, like Either::map.
+// Usage:
+//  EffectVM<float> vm;
+//  vm.addEffect(readAdc);   vm.addMap2(multiply);   vm.addBind(checkRange);   // ids 0
+//  ProgramBuilder<float, 64> b;
+//  b.effect(0, 0).constant(1, 0.0806f).map2(0, 0, 1, 0).bind(0, 0, 0)
+//   .branchLeft(1).ret(0)
+//   .label(1).recover().constant(0, 25.0f).ret(0);
+//  EffectProgram program = b.build().unwrapRight();
+//  vm.run(program).match(...);                   // Either<float, uint8_t>
+//  vm.runBatch(program, inputs, n, values, errors);
+// Note:
+//  - Jumps only go forward, so every program terminates.
+//  - run() checks every operand (registers, function ids, jump targets, program end):
+//    a corrupt or foreign program yields Left(EffectVM::Fault), never undefined
+//    behaviour. The builder rejects registers >= 8 already (ProgramError::BadRegister).
+//  - User error codes: 1..254. 0 marks Right in runBatch and 255 is Fault, so
+//    fail(0) / fail(255) fail the build (ProgramError::ReservedCode), and a bind
+//    returning Left(0) or a Fail operand 0 in a foreign program yields Left(Fault).
+//  - T must be trivially copyable: constants are memcpy'd into the bytecode.
+//  - EffectProgram does not own its bytes (builder, const array or received buffer).
+
+#ifndef FUNCYCONTROLLERCPP_EFFECTVM_HPP
+#define FUNCYCONTROLLERCPP_EFFECTVM_HPP
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For uint8_t, uint16_t
+#include <cstring>      // For memcpy
+#include <initializer_list>
+#include <type_traits>  // For std::is_trivially_copyable
+#include "Maybe.hpp"    // Registration results
+#include "Either.hpp"   // Run results
+
+namespace funcy_controller_cpp {
+
+enum class EffectOp : uint8_t {
+  Input, Constant, Move, Effect, Map, Map2, Bind, BranchLeft, Jump, Recover, Fail, Return
+};
+
+enum class ProgramError : uint8_t {
+  CodeFull,          // Builder capacity exceeded
+  UnknownLabel,      // Jump to a label that was never placed
+  BackwardJump,      // Label placed before the jump
+  DuplicateLabel,
+  ReservedCode,      // fail(0) or fail(255): reserved for Right (runBatch) and Fault
+  BadLabel,          // Label id >= Labels
+  TooManyJumps,      // More than Labels * 2 jumps
+  BadRegister        // Register operand >= 8
+};
+
+// ==================== EffectProgram ====================
+class EffectProgram {
+public:
+  EffectProgram() = default;
+  EffectProgram(const uint8_t* code, size_t size) : code(code), length(size) {}
+
+  const uint8_t* data() const { return code; }
+  size_t size() const { return length; }
+
+private:
+  const uint8_t* code = nullptr;
+  size_t length = 0;
+};
+
+namespace detail {
+
+constexpr uint8_t effectRegisters = 8;  // r0..r7
+
+// Bytes of an instruction (opcode included), 0 for an unknown opcode
+template<typename T>
+inline size_t effectOpLength(uint8_t op) {
+  switch (EffectOp(op)) {
+    case EffectOp::Input:      return 2;
+    case EffectOp::Constant:   return 2 + sizeof(T);
+    case EffectOp::Move:       return 3;
+    case EffectOp::Effect:     return 3;
+    case EffectOp::Map:        return 4;
+    case EffectOp::Map2:       return 5;
+    case EffectOp::Bind:       return 4;
+    case EffectOp::BranchLeft: return 3;
+    case EffectOp::Jump:       return 3;
+    case EffectOp::Recover:    return 1;
+    case EffectOp::Fail:       return 2;
+    case EffectOp::Return:     return 2;
+  }
+  return 0;
+}
+
+// Register operands of an instruction: always the leading operands (dst, sources)
+inline size_t effectRegisterOperands(uint8_t op) {
+  switch (EffectOp(op)) {
+    case EffectOp::Input:
+    case EffectOp::Constant:
+    case EffectOp::Effect:
+    case EffectOp::Return:     return 1;
+    case EffectOp::Move:
+    case EffectOp::Map:
+    case EffectOp::Bind:       return 2;
+    case EffectOp::Map2:       return 3;
+    default:                   return 0;
+  }
+}
+
+// True if all register operands of the instruction at code are < effectRegisters
+inline bool effectRegistersValid(const uint8_t* code) {
+  const size_t n = effectRegisterOperands(code[0]);
+  for (size_t i = 1; i <= n; ++i) {
+    if (code[i] >= effectRegisters) return false;
+  }
+  return true;
+}
+
+} // namespace detail
+
+// ==================== ProgramBuilder<T, Capacity> ====================
+template<typename T, size_t Capacity = 64, size_t Labels = 8>
+class ProgramBuilder {
+public:
+  ProgramBuilder() {
+    for (int16_t& at : labelAt) at = -1;
+  }
+
+  ProgramBuilder& input(uint8_t dst) { return emit({uint8_t(EffectOp::Input), dst}); }
+  ProgramBuilder& move(uint8_t dst, uint8_t src) { return emit({uint8_t(EffectOp::Move), dst, src}); }
+  ProgramBuilder& effect(uint8_t dst, uint8_t fn) { return emit({uint8_t(EffectOp::Effect), dst, fn}); }
+  ProgramBuilder& map(uint8_t dst, uint8_t src, uint8_t fn) { return emit({uint8_t(EffectOp::Map), dst, src, fn}); }
+  ProgramBuilder& map2(uint8_t dst, uint8_t a, uint8_t b, uint8_t fn) {
+    return emit({uint8_t(EffectOp::Map2), dst, a, b, fn});
+  }
+  ProgramBuilder& bind(uint8_t dst, uint8_t src, uint8_t fn) { return emit({uint8_t(EffectOp::Bind), dst, src, fn}); }
+  ProgramBuilder& recover() { return emit({uint8_t(EffectOp::Recover)}); }
+  ProgramBuilder& fail(uint8_t code) {
+    if (code == 0 || code == 0xFF) return setError(ProgramError::ReservedCode);
+    return emit({uint8_t(EffectOp::Fail), code});
+  }
+  ProgramBuilder& ret(uint8_t src) { return emit({uint8_t(EffectOp::Return), src}); }
+
+  ProgramBuilder& constant(uint8_t dst, T value) {
+    uint8_t bytes[2 + sizeof(T)] = {uint8_t(EffectOp::Constant), dst};
+    memcpy(bytes + 2, &value, sizeof(T));
+    return emitBytes(bytes, sizeof(bytes));
+  }
+
+  ProgramBuilder& branchLeft(uint8_t label) { return jumpTo(EffectOp::BranchLeft, label); }
+  ProgramBuilder& jump(uint8_t label) { return jumpTo(EffectOp::Jump, label); }
+
+  // Places label at the current position
+  ProgramBuilder& label(uint8_t id) {
+    if (id >= Labels) return setError(ProgramError::BadLabel);
+    if (labelAt[id] >= 0) return setError(ProgramError::DuplicateLabel);
+    labelAt[id] = int16_t(size);
+    return *this;
+  }
+
+  // Resolves the labels, Right(program viewing this builder's bytes)
+  Either<EffectProgram, ProgramError> build() {
+    if (failed) return Either<EffectProgram, ProgramError>::Left(error);
+    for (size_t i = 0; i < fixupCount; ++i) {
+      const Fixup& f = fixups[i];
+      if (labelAt[f.label] < 0) return Either<EffectProgram, ProgramError>::Left(ProgramError::UnknownLabel);
+      if (size_t(labelAt[f.label]) <= f.at) return Either<EffectProgram, ProgramError>::Left(ProgramError::BackwardJump);
+      code[f.at + 1] = uint8_t(labelAt[f.label] & 0xFF);
+      code[f.at + 2] = uint8_t(labelAt[f.label] >> 8);
+    }
+    return Either<EffectProgram, ProgramError>::Right(EffectProgram(code, size));
+  }
+
+  const uint8_t* data() const { return code; }
+  size_t sizeBytes() const { return size; }
+
+private:
+  struct Fixup {
+    uint16_t at;
+    uint8_t label;
+  };
+
+  uint8_t code[Capacity] = {};
+  size_t size = 0;
+  int16_t labelAt[Labels];
+  Fixup fixups[Labels * 2] = {};
+  size_t fixupCount = 0;
+  bool failed = false;
+  ProgramError error = ProgramError::CodeFull;   // First error (if failed)
+
+  static_assert(std::is_trivially_copyable<T>::value, "ProgramBuilder: T must be trivially copyable");
+  static_assert(Labels <= 8, "ProgramBuilder: at most 8 labels");
+  static_assert(Capacity <= 32767, "ProgramBuilder: jump targets are 16 bit");
+
+  ProgramBuilder& setError(ProgramError e) {
+    if (!failed) {
+      failed = true;
+      error = e;
+    }
+    return *this;
+  }
+
+  ProgramBuilder& emit(std::initializer_list<uint8_t> bytes) {
+    return emitBytes(bytes.begin(), bytes.size());
+  }
+
+  ProgramBuilder& emitBytes(const uint8_t* bytes, size_t n) {
+    if (size + n > Capacity) return setError(ProgramError::CodeFull);
+    if (!detail::effectRegistersValid(bytes)) return setError(ProgramError::BadRegister);
+    memcpy(code + size, bytes, n);
+    size += n;
+    return *this;
+  }
+
+  ProgramBuilder& jumpTo(EffectOp op, uint8_t label) {
+    if (label >= Labels) return setError(ProgramError::BadLabel);
+    if (fixupCount == Labels * 2) return setError(ProgramError::TooManyJumps);
+    const size_t at = size;
+    emit({uint8_t(op), 0, 0});
+    if (size == at + 3) fixups[fixupCount++] = Fixup{uint16_t(at), label};
+    return *this;
+  }
+};
+
+// ==================== EffectVM<T, Functions> ====================
+template<typename T, size_t Functions = 16>
+class EffectVM {
+public:
+  using Result = Either<T, uint8_t>;
+  using EffectFn = T (*)();
+  using MapFn = T (*)(T);
+  using Map2Fn = T (*)(T, T);
+  using BindFn = Either<T, uint8_t> (*)(T);
+
+  static constexpr uint8_t Fault = 0xFF;   // Malformed program
+  static constexpr uint8_t registers = detail::effectRegisters;
+  static_assert((registers & (registers - 1)) == 0, "EffectVM: register checks OR the operands");
+
+  // Registration: Just(id), Nothing if the table is full
+  Maybe<uint8_t> addEffect(EffectFn fn) { return add(effects, effectCount, fn); }
+  Maybe<uint8_t> addMap(MapFn fn) { return add(maps, mapCount, fn); }
+  Maybe<uint8_t> addMap2(Map2Fn fn) { return add(maps2, map2Count, fn); }
+  Maybe<uint8_t> addBind(BindFn fn) { return add(binds, bindCount, fn); }
+
+  // Runs program once, input is available through the input instruction
+  Result run(const EffectProgram& program, T input = T()) const {
+    T r[registers] = {};
+    const uint8_t* code = program.data();
+    const size_t size = program.size();
+    bool ok = true;
+    uint8_t error = 0;
+    size_t pc = 0;
+
+    while (pc < size) {
+      const uint8_t op = code[pc];
+      const size_t length = detail::effectOpLength<T>(op);
+      if (length == 0 || pc + length > size) return Result::Left(Fault);
+      const uint8_t* a = code + pc + 1;   // Operands
+      size_t next = pc + length;
+
+      switch (EffectOp(op)) {
+        case EffectOp::Input:
+          if (a[0] >= registers) return Result::Left(Fault);
+          if (ok) r[a[0]] = input;
+          break;
+        case EffectOp::Constant:
+          if (a[0] >= registers) return Result::Left(Fault);
+          if (ok) memcpy(&r[a[0]], a + 1, sizeof(T));
+          break;
+        case EffectOp::Move:
+          if ((a[0] | a[1]) >= registers) return Result::Left(Fault);   // registers is a power of 2
+          if (ok) r[a[0]] = r[a[1]];
+          break;
+        case EffectOp::Effect:
+          if (a[0] >= registers || a[1] >= effectCount) return Result::Left(Fault);
+          if (ok) r[a[0]] = effects[a[1]]();
+          break;
+        case EffectOp::Map:
+          if ((a[0] | a[1]) >= registers || a[2] >= mapCount) return Result::Left(Fault);
+          if (ok) r[a[0]] = maps[a[2]](r[a[1]]);
+          break;
+        case EffectOp::Map2:
+          if ((a[0] | a[1] | a[2]) >= registers || a[3] >= map2Count) return Result::Left(Fault);
+          if (ok) r[a[0]] = maps2[a[3]](r[a[1]], r[a[2]]);
+          break;
+        case EffectOp::Bind:
+          if ((a[0] | a[1]) >= registers || a[2] >= bindCount) return Result::Left(Fault);
+          if (ok) {
+            const Result b = binds[a[2]](r[a[1]]);
+            if (b.isRight()) {
+              r[a[0]] = b.unwrapRight();
+            } else {
+              ok = false;
+              error = b.unwrapLeft() == 0 ? Fault : b.unwrapLeft();   // 0 is reserved for Right
+            }
+          }
+          break;
+        case EffectOp::BranchLeft:
+        case EffectOp::Jump: {
+          const size_t target = size_t(a[0]) | (size_t(a[1]) << 8);
+          if (target <= pc || target > size) return Result::Left(Fault);   // Forward only
+          if (EffectOp(op) == EffectOp::Jump || !ok) next = target;
+          break;
+        }
+        case EffectOp::Recover:
+          ok = true;
+          break;
+        case EffectOp::Fail:
+          if (a[0] == 0) return Result::Left(Fault);
+          ok = false;
+          error = a[0];
+          break;
+        case EffectOp::Return:
+          if (a[0] >= registers) return Result::Left(Fault);
+          return ok ? Result::Right(r[a[0]]) : Result::Left(error);
+      }
+      pc = next;
+    }
+    return Result::Left(Fault);   // No ret
+  }
+
+  // Runs program for every input: values[i] on Right (errors[i] = 0),
+  // errors[i] = code (never 0) on Left. Returns the number of Right results.
+  size_t runBatch(const EffectProgram& program, const T* inputs, size_t n, T* values, uint8_t* errors) const {
+    size_t rights = 0;
+    for (size_t i = 0; i < n; ++i) {
+      const Result result = run(program, inputs[i]);
+      if (result.isRight()) {
+        values[i] = result.unwrapRight();
+        errors[i] = 0;
+        ++rights;
+      } else {
+        errors[i] = result.unwrapLeft();
+      }
+    }
+    return rights;
+  }
+
+private:
+  EffectFn effects[Functions] = {};
+  MapFn maps[Functions] = {};
+  Map2Fn maps2[Functions] = {};
+  BindFn binds[Functions] = {};
+  uint8_t effectCount = 0, mapCount = 0, map2Count = 0, bindCount = 0;
+
+  static_assert(std::is_trivially_copyable<T>::value, "EffectVM: T must be trivially copyable");
+  static_assert(Functions <= 255, "EffectVM: function ids are 8 bit");
+
+  template<typename Fn>
+  static Maybe<uint8_t> add(Fn* table, uint8_t& count, Fn fn) {
+    if (count >= Functions || fn == nullptr) return Maybe<uint8_t>::Nothing();
+    table[count] = fn;
+    return Maybe<uint8_t>::Just(count++);
+  }
+};
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_EFFECTVM_HPP
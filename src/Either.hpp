@@ -1,4 +1,7 @@
 // ==================== Either<T, E> ====================
+// Note:
+//  - Everything except toString() is constexpr: with literal T and E (and constexpr
+//    lambdas) Either values can be built and inspected at compile time.
 #ifndef FUNCYCONTROLLERCPP_EITHER_HPP 
 #define FUNCYCONTROLLERCPP_EITHER_HPP 
 
@@ -7,6 +10,8 @@
 
 namespace funcy_controller_cpp {
 
+namespace detail { template<typename R> struct CoroutineResult; } // See Coroutines.hpp
+
 template<typename T, typename E>
 class Either {
 public:
@@ -15,27 +20,27 @@ public:
   using error_type = E;
   
   // Constructors
-  static Either Right(T value) {
+  static constexpr Either Right(T value) {
     return Either(value, {}, true);
   }
 
-  static Either Left(E error) {
+  static constexpr Either Left(E error) {
     return Either({}, error, false);
   }
 
   // Introspection
-  bool isRight() const { return right; }
-  bool isLeft() const { return !right; }
+  constexpr bool isRight() const { return right; }
+  constexpr bool isLeft() const { return !right; }
 
   // Accessors (Use with caution, prefer match/fold)
   // Hint: In FP the best way is to access the func
   // outputs via match and fold.
-  T unwrapRight() const { return value; }
-  E unwrapLeft() const { return error; }
+  constexpr T unwrapRight() const { return value; }
+  constexpr E unwrapLeft() const { return error; }
 
   // Map: transform Right
   template<typename F>
-  auto map(F f) const {
+  constexpr auto map(F f) const {
     using R = decltype(f(value));
     if (right) return Either<R, E>::Right(f(value));
     return Either<R, E>::Left(error);
@@ -43,7 +48,7 @@ public:
 
   // flatMap (bind): transform Right into another Either
   template<typename F>
-  auto flatMap(F f) const {
+  constexpr auto flatMap(F f) const {
     using Ret = decltype(f(value));
     if (right) return f(value);
     return Ret::Left(error);
@@ -51,7 +56,7 @@ public:
 
   // mapLeft: transform Left (the error)
   template<typename F>
-  auto mapLeft(F f) const {
+  constexpr auto mapLeft(F f) const {
     using E2 = decltype(f(error));
     if (right) return Either<T, E2>::Right(value);
     return Either<T, E2>::Left(f(error));
@@ -60,17 +65,22 @@ public:
   // match: pattern-match both sides
   // handle both Rigth and Error cases seperately
   template<typename LeftFn, typename RightFn>
-  auto match(LeftFn onLeft, RightFn onRight) const {
+  constexpr auto match(LeftFn onLeft, RightFn onRight) const {
     return right ? onRight(value) : onLeft(error);
   }
 
   // fold: convert to a value
   // combines the results from both cases (right OR left) into a single value
   template<typename LeftFn, typename RightFn>
-  auto fold(LeftFn onLeft, RightFn onRight) const {
+  constexpr auto fold(LeftFn onLeft, RightFn onRight) const {
     return right ? onRight(value) : onLeft(error);
   }
 
+#if defined(__cpp_impl_coroutine)
+  // Coroutine support: result of a co_await function (see Coroutines.hpp)
+  Either(detail::CoroutineResult<Either>&& result);
+#endif
+
   // Debug toString
   String toString() const {
     return right ? "Right(" + value + ")" : "Left(" + error + ")";
@@ -82,7 +92,7 @@ private:
   bool right;
 
   // Default construct T and E if possible, or handle initialization carefully
-  Either(T val, E err, bool isRight)
+  constexpr Either(T val, E err, bool isRight)
     : value(val), error(err), right(isRight) {}
   
   // Allow default construction if T and E are default constructible
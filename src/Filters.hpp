@@ -0,0 +1,259 @@
+// ==================== Streaming filters ====================
+// Concept:
+//  - Stateful, allocation-free filters: MovingAverage, Ema, Biquad, MedianFilter.
+//  - filter(x): push one sample, get the filtered value.
+//  - filter.process(in, out, n): the same for a whole block (in and out must not overlap).
+//  - stage(filter): use a filter as a map stage (IO::map, Maybe::map, LazySeq::map, ...).
+//    The stage refers to the filter, so its state survives between runs
+//    and nothing is copied into the closure. The filter must outlive the stage.
+// Usage:
+//  Ema<float> smooth(0.1f);                      // global / static, not in loop()!
+//  IO<float> smoothed = readSensor().map(stage(smooth));
+// Note:
+//  - The block variants are tight loops without per-sample call overhead.
+//    MovingAverage reads the oldest sample straight from the input instead of the ring,
+//    the recursive filters (Ema, Biquad) are serial in time by nature.
+
+#ifndef FUNCYCONTROLLERCPP_FILTERS_HPP
+#define FUNCYCONTROLLERCPP_FILTERS_HPP
+
+#include <cstddef>      // For size_t
+#include <math.h>       // For cosf, sinf (Biquad design)
+
+namespace funcy_controller_cpp {
+
+// ==================== stage() ====================
+template<typename Op>
+class StageRef {
+public:
+  explicit StageRef(Op& op) : op(&op) {}
+
+  template<typename X>
+  auto operator()(const X& x) const { return (*op)(x); }
+
+private:
+  Op* op;
+};
+
+template<typename Op>
+StageRef<Op> stage(Op& op) {
+  return StageRef<Op>(op);
+}
+
+// ==================== MovingAverage<T, N> ====================
+// Mean of the last N samples (of fewer while the window fills up)
+template<typename T, size_t N, typename Acc = T>
+class MovingAverage {
+public:
+  static_assert(N > 0, "MovingAverage needs a window of at least 1");
+
+  T operator()(T x) {
+    sum += Acc(x) - Acc(window[head]);
+    window[head] = x;
+    head = (head + 1 == N) ? 0 : head + 1;
+    if (count < N) ++count;
+    return T(sum / Acc(count));
+  }
+
+  void process(const T* in, T* out, size_t n) {
+    // Fill up the window sample by sample
+    size_t i = 0;
+    for (; i < n && count < N; ++i) out[i] = (*this)(in[i]);
+    if (i == n) return;
+
+    // Window is full: sum[i] = sum[i-1] + in[i] - oldest.
+    // oldest comes from the ring for the first N samples, then from the input itself.
+    const size_t start = i;
+    const size_t fromRing = (n - start < N) ? n - start : N;
+    Acc acc = sum;  // Local copy: stores to out cannot alias it
+    size_t slot = head;
+    for (size_t k = 0; k < fromRing; ++k, ++i) {
+      acc += Acc(in[i]) - Acc(window[slot]);
+      slot = (slot + 1 == N) ? 0 : slot + 1;
+      out[i] = T(acc / Acc(N));
+    }
+    for (; i < n; ++i) {
+      acc += Acc(in[i]) - Acc(in[i - N]);
+      out[i] = T(acc / Acc(N));
+    }
+    sum = acc;
+
+    // Keep the ring in sync with the last N inputs
+    const size_t processed = n - start;
+    if (processed >= N) {
+      for (size_t k = 0; k < N; ++k) window[k] = in[n - N + k];
+      head = 0;
+    } else {
+      for (size_t k = 0; k < processed; ++k) {
+        window[head] = in[start + k];
+        head = (head + 1 == N) ? 0 : head + 1;
+      }
+    }
+  }
+
+  void reset() { *this = MovingAverage(); }
+
+private:
+  T window[N] = {};
+  Acc sum = Acc();
+  size_t head = 0;
+  size_t count = 0;
+};
+
+// ==================== Ema<T> ====================
+// Exponential moving average: y += alpha * (x - y), seeded with the first sample
+template<typename T>
+class Ema {
+public:
+  explicit Ema(T alpha) : alpha(alpha) {}
+
+  T operator()(T x) {
+    if (!seeded) {
+      y = x;
+      seeded = true;
+    } else {
+      y += alpha * (x - y);
+    }
+    return y;
+  }
+
+  void process(const T* in, T* out, size_t n) {
+    if (n == 0) return;
+    size_t i = 0;
+    if (!seeded) out[i++] = (*this)(in[0]);
+    T acc = y;
+    for (; i < n; ++i) {
+      acc += alpha * (in[i] - acc);
+      out[i] = acc;
+    }
+    y = acc;
+  }
+
+  void reset() { seeded = false; y = T(); }
+
+private:
+  T alpha;
+  T y = T();
+  bool seeded = false;
+};
+
+// ==================== Biquad<T> ====================
+// Second order IIR section, direct form II transposed
+template<typename T>
+class Biquad {
+public:
+  struct Coefficients {
+    T b0, b1, b2, a1, a2;  // a0 normalized to 1
+  };
+
+  explicit Biquad(Coefficients c) : c(c) {}
+
+  // RBJ cookbook designs (sampleRate, cutoff in Hz, q = 0.7071 for Butterworth)
+  static Biquad lowPass(float sampleRate, float cutoff, float q = 0.70710678f) {
+    const float w = 2.0f * 3.14159265f * cutoff / sampleRate;
+    const float alpha = sinf(w) / (2.0f * q);
+    const float cosw = cosf(w);
+    const float a0 = 1.0f + alpha;
+    return Biquad(Coefficients{
+      T((1.0f - cosw) / 2.0f / a0), T((1.0f - cosw) / a0), T((1.0f - cosw) / 2.0f / a0),
+      T(-2.0f * cosw / a0), T((1.0f - alpha) / a0)
+    });
+  }
+
+  static Biquad highPass(float sampleRate, float cutoff, float q = 0.70710678f) {
+    const float w = 2.0f * 3.14159265f * cutoff / sampleRate;
+    const float alpha = sinf(w) / (2.0f * q);
+    const float cosw = cosf(w);
+    const float a0 = 1.0f + alpha;
+    return Biquad(Coefficients{
+      T((1.0f + cosw) / 2.0f / a0), T(-(1.0f + cosw) / a0), T((1.0f + cosw) / 2.0f / a0),
+      T(-2.0f * cosw / a0), T((1.0f - alpha) / a0)
+    });
+  }
+
+  T operator()(T x) {
+    const T y = c.b0 * x + z1;
+    z1 = c.b1 * x - c.a1 * y + z2;
+    z2 = c.b2 * x - c.a2 * y;
+    return y;
+  }
+
+  void process(const T* in, T* out, size_t n) {
+    T s1 = z1, s2 = z2;
+    const Coefficients k = c;
+    for (size_t i = 0; i < n; ++i) {
+      const T x = in[i];
+      const T y = k.b0 * x + s1;
+      s1 = k.b1 * x - k.a1 * y + s2;
+      s2 = k.b2 * x - k.a2 * y;
+      out[i] = y;
+    }
+    z1 = s1;
+    z2 = s2;
+  }
+
+  void reset() { z1 = T(); z2 = T(); }
+
+private:
+  Coefficients c;
+  T z1 = T();
+  T z2 = T();
+};
+
+// ==================== MedianFilter<T, N> ====================
+// Median of the last N samples (N odd), removes spikes. O(N) per sample.
+// The sorted window keeps the ring slot of every sample: the oldest one is removed
+// by its slot, not by value. NaN sorts above every number, so a NaN sample is
+// treated like a positive spike and leaves the window after N samples.
+template<typename T, size_t N>
+class MedianFilter {
+public:
+  static_assert(N % 2 == 1, "MedianFilter needs an odd window");
+
+  T operator()(T x) {
+    if (count == N) {
+      // Remove the oldest sample (the one in ring slot head)
+      size_t i = 0;
+      while (slot[i] != head) ++i;
+      for (; i + 1 < count; ++i) {
+        sorted[i] = sorted[i + 1];
+        slot[i] = slot[i + 1];
+      }
+      --count;
+    }
+
+    // Insert the new sample
+    size_t i = count;
+    while (i > 0 && after(sorted[i - 1], x)) {
+      sorted[i] = sorted[i - 1];
+      slot[i] = slot[i - 1];
+      --i;
+    }
+    sorted[i] = x;
+    slot[i] = head;
+    ++count;
+    head = (head + 1 == N) ? 0 : head + 1;
+    return sorted[count / 2];
+  }
+
+  void process(const T* in, T* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) out[i] = (*this)(in[i]);
+  }
+
+  void reset() { count = 0; head = 0; }
+
+private:
+  T sorted[N] = {};
+  size_t slot[N] = {};   // Ring slot of sorted[i]
+  size_t head = 0;
+  size_t count = 0;
+
+  // Sort order with NaN above every number (only NaN != NaN)
+  static bool after(const T& a, const T& b) {
+    return a > b || (a != a && b == b);
+  }
+};
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_FILTERS_HPP
@@ -0,0 +1,177 @@
+// ==================== Fixed<I, F> ====================
+// Concept:
+//  - Signed fixed-point number with I integer bits (including the sign bit)
+//    and F fractional bits, stored in an int8_t / int16_t / int32_t (I + F = 8, 16, 32).
+//  - Operators (+, -, *, /) saturate at min() / max() instead of wrapping around.
+//  - checkedAdd / checkedSub / checkedMul / checkedDiv return
+//    Either<Fixed, OverflowError> instead of saturating, to detect overflows.
+//  - Everything is constexpr, static factories can be passed to map / flatMap:
+//      readAdc().map(Q16_16::fromInt)
+//      Either<Q16_16, OverflowError>::Right(x).flatMap([](Q16_16 v) { return v.checkedMul(GAIN); })
+// Use cases:
+//  - Filter / calibration math on targets without FPU (soft-float is slow).
+
+#ifndef FUNCYCONTROLLERCPP_FIXED_HPP
+#define FUNCYCONTROLLERCPP_FIXED_HPP
+
+#include <cstdint>      // For int8_t ... int64_t
+#include "Either.hpp"   // Checked operations return Either
+
+namespace funcy_controller_cpp {
+
+enum class OverflowError : uint8_t {
+  Overflow,        // Result above max()
+  Underflow,       // Result below min()
+  DivisionByZero
+};
+
+namespace detail {
+
+// Storage and intermediate (wide) type per total bit count
+template<int Bits> struct FixedStorage;
+template<> struct FixedStorage<8>  { using type = int8_t;  using wide = int16_t; };
+template<> struct FixedStorage<16> { using type = int16_t; using wide = int32_t; };
+template<> struct FixedStorage<32> { using type = int32_t; using wide = int64_t; };
+
+} // namespace detail
+
+template<int I, int F>
+class Fixed {
+public:
+  static_assert(I >= 1 && F >= 0, "Fixed needs at least the sign bit");
+  static_assert(I + F == 8 || I + F == 16 || I + F == 32, "Fixed<I, F> needs I + F = 8, 16 or 32");
+
+  using raw_type = typename detail::FixedStorage<I + F>::type;
+  using wide_type = typename detail::FixedStorage<I + F>::wide;
+  using Checked = Either<Fixed, OverflowError>;
+
+  static constexpr int integerBits = I;
+  static constexpr int fractionBits = F;
+
+  // Zero
+  constexpr Fixed() : value(0) {}
+
+  // ---------- Constructors ----------
+
+  static constexpr Fixed fromRaw(raw_type raw) {
+    Fixed f;
+    f.value = raw;
+    return f;
+  }
+
+  // fromInt / fromFloat: saturate if the value is out of range (NaN -> 0)
+  static constexpr Fixed fromInt(long v) {
+    if (v > long(maxRaw() >> F)) return max();
+    if (v < long(minRaw() >> F)) return min();
+    return fromRaw(raw_type(wide_type(v) * one()));
+  }
+
+  static constexpr Fixed fromFloat(float v) {
+    const float scaled = v * float(one());
+    if (scaled != scaled) return Fixed();
+    if (scaled >= float(maxRaw())) return max();
+    if (scaled <= float(minRaw())) return min();
+    return fromRaw(raw_type(scaled + (scaled >= 0 ? 0.5f : -0.5f)));
+  }
+
+  // Left if v, rounded to the nearest raw value, does not fit. Rounded and compared
+  // as integers: float(maxRaw()) rounds up to 2^31 for the 32-bit formats.
+  static constexpr Checked fromFloatChecked(float v) {
+    const float scaled = v * float(one());            // Exact: times a power of two
+    if (scaled != scaled) return Checked::Left(OverflowError::Overflow);
+    const float range = 2.0f * float(one()) * float(wide_type(1) << (I - 1));   // 2^(I+F), exact
+    if (scaled >= range) return Checked::Left(OverflowError::Overflow);       // Also inf
+    if (scaled <= -range) return Checked::Left(OverflowError::Underflow);
+    const wide_type truncated = wide_type(scaled);
+    const float rest = scaled - float(truncated);     // Exact, |rest| < 1
+    const wide_type rounded = truncated + (rest >= 0.5f ? 1 : 0) - (rest <= -0.5f ? 1 : 0);
+    if (rounded > maxRaw()) return Checked::Left(OverflowError::Overflow);
+    if (rounded < minRaw()) return Checked::Left(OverflowError::Underflow);
+    return Checked::Right(fromRaw(raw_type(rounded)));
+  }
+
+  static constexpr Fixed max() { return fromRaw(maxRaw()); }
+  static constexpr Fixed min() { return fromRaw(minRaw()); }
+  static constexpr Fixed epsilon() { return fromRaw(1); }
+
+  // ---------- Conversions ----------
+
+  constexpr raw_type raw() const { return value; }
+  constexpr float toFloat() const { return float(value) / float(one()); }
+  // Rounds towards minus infinity
+  constexpr long toInt() const { return long(value >> F); }
+
+  // ---------- Saturating arithmetic ----------
+
+  constexpr Fixed operator+(Fixed o) const { return saturate(wide_type(value) + o.value); }
+  constexpr Fixed operator-(Fixed o) const { return saturate(wide_type(value) - o.value); }
+  constexpr Fixed operator*(Fixed o) const { return saturate(mulWide(o)); }
+  constexpr Fixed operator/(Fixed o) const {
+    if (o.value == 0) return (value >= 0) ? max() : min();
+    return saturate(divWide(o));
+  }
+  constexpr Fixed operator-() const { return saturate(-wide_type(value)); }
+
+  constexpr Fixed& operator+=(Fixed o) { return *this = *this + o; }
+  constexpr Fixed& operator-=(Fixed o) { return *this = *this - o; }
+  constexpr Fixed& operator*=(Fixed o) { return *this = *this * o; }
+  constexpr Fixed& operator/=(Fixed o) { return *this = *this / o; }
+
+  // ---------- Checked arithmetic ----------
+
+  constexpr Checked checkedAdd(Fixed o) const { return check(wide_type(value) + o.value); }
+  constexpr Checked checkedSub(Fixed o) const { return check(wide_type(value) - o.value); }
+  constexpr Checked checkedMul(Fixed o) const { return check(mulWide(o)); }
+  constexpr Checked checkedDiv(Fixed o) const {
+    if (o.value == 0) return Checked::Left(OverflowError::DivisionByZero);
+    return check(divWide(o));
+  }
+
+  // ---------- Comparison ----------
+
+  constexpr bool operator==(Fixed o) const { return value == o.value; }
+  constexpr bool operator!=(Fixed o) const { return value != o.value; }
+  constexpr bool operator<(Fixed o) const { return value < o.value; }
+  constexpr bool operator<=(Fixed o) const { return value <= o.value; }
+  constexpr bool operator>(Fixed o) const { return value > o.value; }
+  constexpr bool operator>=(Fixed o) const { return value >= o.value; }
+
+private:
+  raw_type value;
+
+  static constexpr wide_type one() { return wide_type(1) << F; }
+  static constexpr raw_type maxRaw() { return raw_type(~(uint64_t(1) << (I + F - 1))); }
+  static constexpr raw_type minRaw() { return raw_type(-wide_type(maxRaw()) - 1); }
+
+  // Products are rounded to nearest
+  constexpr wide_type mulWide(Fixed o) const {
+    const wide_type product = wide_type(value) * o.value;
+    return (F > 0) ? (product + (wide_type(1) << (F > 0 ? F - 1 : 0))) >> F : product;
+  }
+
+  constexpr wide_type divWide(Fixed o) const {
+    return wide_type(value) * one() / o.value;
+  }
+
+  static constexpr Fixed saturate(wide_type w) {
+    if (w > maxRaw()) return max();
+    if (w < minRaw()) return min();
+    return fromRaw(raw_type(w));
+  }
+
+  static constexpr Checked check(wide_type w) {
+    if (w > maxRaw()) return Checked::Left(OverflowError::Overflow);
+    if (w < minRaw()) return Checked::Left(OverflowError::Underflow);
+    return Checked::Right(fromRaw(raw_type(w)));
+  }
+};
+
+// Common formats
+using Q8_8 = Fixed<8, 8>;
+using Q16_16 = Fixed<16, 16>;
+using Q1_15 = Fixed<1, 15>;
+using Q1_31 = Fixed<1, 31>;
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_FIXED_HPP
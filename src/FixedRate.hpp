@@ -0,0 +1,204 @@
+// ==================== FixedRate<T, Clock> ====================
+// Concept:
+//  - every(io, period) runs an IO at a fixed rate against absolute deadlines
+//    (start + k * period), so the period does not drift by the time the chain
+//    takes, unlike delay(period) at the end of loop().
+//  - poll() is non-blocking: call it from loop(), it runs the IO once if its
+//    deadline has passed. Result: Maybe<T> (bool for IO<void>).
+//  - A run that starts a full period (or more) late is an overrun. The policy
+//    decides what happens to the missed deadlines:
+//      OverrunPolicy::CatchUp - run once per missed deadline, back to back
+//      OverrunPolicy::Skip    - drop them, continue with the next future deadline
+//  - Lateness (start time - deadline) is recorded in a fixed histogram
+//    (JitterHistogram): min / max / p99, no heap.
+// Usage:
+//  IO<float> sample = readFiltered();
+//  auto sampler = every(sample, 10);             // every 10 ms (millis), global / static
+//  void loop() {
+//    sampler.poll().match([](float v) { log(v); }, []() {});
+//    // sampler.jitter().p99(), sampler.overruns()
+//  }
+// Note:
+//  - The clock is any callable returning the current time in the unit of period
+//    (default millis, e.g. micros for sub-millisecond periods). Wrap-around safe.
+//  - The histogram covers lateness 0 .. period in FUNCYCONTROLLERCPP_JITTER_BUCKETS
+//    buckets; later starts land in the last bucket. p99 is the upper edge of its bucket.
+
+#ifndef FUNCYCONTROLLERCPP_FIXEDRATE_HPP
+#define FUNCYCONTROLLERCPP_FIXEDRATE_HPP
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For uint8_t, uint32_t
+#include <type_traits>  // For std::is_void
+#include <utility>      // For std::move
+#include "Maybe.hpp"    // poll() result
+#include <Arduino.h>    // For millis (default clock)
+#include "IO.hpp"       // The IO run by FixedRate
+
+#ifndef FUNCYCONTROLLERCPP_JITTER_BUCKETS
+#define FUNCYCONTROLLERCPP_JITTER_BUCKETS 32
+#endif
+
+namespace funcy_controller_cpp {
+
+// What every() does with deadlines missed by a full period
+enum class OverrunPolicy : uint8_t {
+  CatchUp,  // Run once per missed deadline, back to back
+  Skip      // Drop the missed deadlines
+};
+
+// ==================== JitterHistogram ====================
+class JitterHistogram {
+public:
+  static constexpr size_t buckets = FUNCYCONTROLLERCPP_JITTER_BUCKETS;
+  static_assert(buckets >= 2, "JitterHistogram needs at least 2 buckets");
+
+  // Buckets of width bucketWidth, the last one collects everything above
+  explicit JitterHistogram(unsigned long bucketWidth = 1)
+    : width(bucketWidth == 0 ? 1 : bucketWidth) {}
+
+  void add(unsigned long lateness) {
+    const unsigned long index = lateness / width;
+    ++counts[index < buckets - 1 ? index : buckets - 1];
+    if (samples == 0 || lateness < minimum) minimum = lateness;
+    if (samples == 0 || lateness > maximum) maximum = lateness;
+    ++samples;
+  }
+
+  uint32_t count() const { return samples; }
+  unsigned long min() const { return minimum; }
+  unsigned long max() const { return maximum; }
+  unsigned long bucketWidth() const { return width; }
+  uint32_t bucket(size_t i) const { return counts[i]; }
+
+  // Upper edge of the bucket holding the q-th quantile (0 < q <= 1), capped at max()
+  unsigned long quantile(float q) const {
+    if (samples == 0) return 0;
+    const uint32_t rank = uint32_t(q * samples + 0.999f);  // ceil, at least 1
+    uint32_t seen = 0;
+    for (size_t i = 0; i < buckets - 1; ++i) {
+      seen += counts[i];
+      if (seen >= rank) {
+        const unsigned long edge = (i + 1) * width - 1;
+        return edge < maximum ? edge : maximum;
+      }
+    }
+    return maximum;
+  }
+
+  unsigned long p99() const { return quantile(0.99f); }
+
+  void clear() {
+    for (uint32_t& c : counts) c = 0;
+    samples = 0;
+    minimum = maximum = 0;
+  }
+
+private:
+  unsigned long width;
+  uint32_t counts[buckets] = {};
+  uint32_t samples = 0;
+  unsigned long minimum = 0;
+  unsigned long maximum = 0;
+};
+
+namespace detail {
+
+template<typename T> struct PollResult { using type = Maybe<T>; };
+template<> struct PollResult<void> { using type = bool; };
+
+} // namespace detail
+
+// ==================== FixedRate<T, Clock> ====================
+template<typename T, typename Clock>
+class FixedRate {
+public:
+  using Result = typename detail::PollResult<T>::type;
+
+  FixedRate(IO<T> io, unsigned long period, OverrunPolicy policy, Clock clock)
+    : io(std::move(io)), clock(clock), period(period == 0 ? 1 : period), policy(policy),
+      histogram((this->period + JitterHistogram::buckets - 2) / (JitterHistogram::buckets - 1)) {}
+
+  // Runs the IO if its deadline has passed (the first poll starts the schedule)
+  Result poll() {
+    const unsigned long now = clock();
+    if (!started) {
+      started = true;
+      deadline = now;
+    }
+    const unsigned long lateness = now - deadline;   // Wrap-around safe
+    if (lateness > maxLateness()) return idle();     // Deadline still ahead
+
+    histogram.add(lateness);
+    ++runCount;
+    if (lateness >= period) {
+      ++overrunCount;
+      if (policy == OverrunPolicy::Skip) {
+        const unsigned long missed = lateness / period;
+        skippedCount += missed;
+        deadline += missed * period;
+      }
+    }
+    deadline += period;
+    if constexpr (std::is_void<T>::value) {
+      io.run();
+      return true;
+    } else {
+      return Maybe<T>::Just(io.run());
+    }
+  }
+
+  // Time until the next deadline (0 if it has passed), e.g. for a sleep
+  unsigned long timeUntilNext() const {
+    if (!started) return 0;
+    const unsigned long now = clock();
+    return (now - deadline) > maxLateness() ? deadline - now : 0;
+  }
+
+  unsigned long nextDeadline() const { return deadline; }
+  unsigned long periodLength() const { return period; }
+
+  uint32_t runs() const { return runCount; }
+  uint32_t overruns() const { return overrunCount; }      // Runs started >= 1 period late
+  uint32_t skipped() const { return skippedCount; }       // Deadlines dropped (Skip policy)
+  const JitterHistogram& jitter() const { return histogram; }
+
+  // Restart the schedule on the next poll, clear the statistics
+  void reset() {
+    started = false;
+    runCount = overrunCount = skippedCount = 0;
+    histogram.clear();
+  }
+
+private:
+  IO<T> io;
+  Clock clock;
+  unsigned long period;
+  OverrunPolicy policy;
+  JitterHistogram histogram;
+  unsigned long deadline = 0;
+  bool started = false;
+  uint32_t runCount = 0;
+  uint32_t overrunCount = 0;
+  uint32_t skippedCount = 0;
+
+  // now - deadline above this: the deadline is in the future (difference wrapped)
+  static constexpr unsigned long maxLateness() { return ~0UL / 2; }
+
+  Result idle() const {
+    if constexpr (std::is_void<T>::value) return false;
+    else return Maybe<T>::Nothing();
+  }
+};
+
+// ==================== every ====================
+// Fixed-rate runner with absolute deadlines, call poll() from loop()
+template<typename T, typename Clock = unsigned long (*)()>
+FixedRate<T, Clock> every(IO<T> io, unsigned long period, OverrunPolicy policy = OverrunPolicy::CatchUp,
+                          Clock clock = millis) {
+  return FixedRate<T, Clock>(std::move(io), period, policy, clock);
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_FIXEDRATE_HPP
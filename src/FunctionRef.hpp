@@ -0,0 +1,82 @@
+// ==================== FunctionRef<R(Args...)> ====================
+// Concept:
+//  - Non-owning reference to a callable: one pointer plus one thunk, trivially
+//    copyable, never allocates. The counterpart of std::function for callbacks that
+//    are invoked synchronously (match / fold, run paths, helper parameters).
+//  - Function pointers and captureless lambdas are stored as a function pointer,
+//    so they stay valid on their own. Other callables are referenced: they must
+//    outlive the FunctionRef.
+// Usage:
+//  int apply(FunctionRef<int(int)> f, int x) { return f(x); }
+//  apply([offset](int x) { return x + offset; }, 4);      // Fine: used during the call
+//  maybe.match(FunctionRef<void(int)>(onValue), onNothing);
+// Note:
+//  - Do not keep a FunctionRef to a temporary capturing lambda beyond the full
+//    expression (e.g. in an IO that runs later).
+//  - Passing FunctionRef<Sig> to template helpers (match, fold, mapIOEither, ...)
+//    instantiates them once per signature instead of once per lambda type.
+
+#ifndef FUNCYCONTROLLERCPP_FUNCTIONREF_HPP
+#define FUNCYCONTROLLERCPP_FUNCTIONREF_HPP
+
+#include <memory>       // For std::addressof
+#include <type_traits>  // For std::enable_if_t, std::is_convertible, std::decay_t
+#include <utility>      // For std::forward, std::declval
+
+namespace funcy_controller_cpp {
+
+template<typename Sig> class FunctionRef;
+
+template<typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+public:
+  using Function = R (*)(Args...);
+
+  // Function pointer (stored by value)
+  constexpr FunctionRef(Function fn) noexcept : target(fn), thunk(&callFunction) {}
+
+  // Captureless lambda (converted to a function pointer, stored by value)
+  template<typename F, typename D = std::decay_t<F>,
+           std::enable_if_t<!std::is_same<D, FunctionRef>::value
+                            && std::is_convertible<D, Function>::value, int> = 0>
+  constexpr FunctionRef(F&& f) noexcept : target(static_cast<Function>(f)), thunk(&callFunction) {}
+
+  // Any other callable (referenced, must outlive this FunctionRef)
+  template<typename F, typename D = std::decay_t<F>,
+           std::enable_if_t<!std::is_same<D, FunctionRef>::value
+                            && !std::is_convertible<D, Function>::value, int> = 0,
+           typename = decltype(std::declval<std::remove_reference_t<F>&>()(std::declval<Args>()...))>
+  FunctionRef(F&& f) noexcept
+    : target(static_cast<void*>(const_cast<std::remove_const_t<std::remove_reference_t<F>>*>(std::addressof(f)))),
+      thunk(&callObject<std::remove_reference_t<F>>) {}
+
+  constexpr R operator()(Args... args) const {
+    return thunk(target, std::forward<Args>(args)...);
+  }
+
+private:
+  union Target {
+    void* object;
+    Function function;
+    constexpr Target(void* object) : object(object) {}
+    constexpr Target(Function function) : function(function) {}
+  };
+
+  using Thunk = R (*)(Target, Args&&...);
+
+  Target target;
+  Thunk thunk;
+
+  static constexpr R callFunction(Target t, Args&&... args) {
+    return t.function(std::forward<Args>(args)...);
+  }
+
+  template<typename F>
+  static R callObject(Target t, Args&&... args) {
+    return (*static_cast<F*>(t.object))(std::forward<Args>(args)...);
+  }
+};
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_FUNCTIONREF_HPP
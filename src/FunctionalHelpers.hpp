@@ -3,6 +3,7 @@
 
 #include "IO.hpp"          // Needs IO definition
 #include "Either.hpp"      // Needs Either definition
+#include "FunctionRef.hpp" // Non-owning overloads
 #include <functional>   // For std::function
 #include <type_traits>  // For decltype, type deduction helpers
 
@@ -67,6 +68,24 @@ IO<Either<E, T>> liftIOtoEither(
   });
 }
 
+// runIOtoEither(): run io now and classify the value: Right(value), or
+// Left(errorFn(value)) if isError(value). The synchronous form of liftIOtoEither():
+// the FunctionRefs are only used during the call, so any callable (even a temporary
+// capturing lambda) can be passed. Result order is Either<T, E> (value Right) like
+// the rest of the library, not the Either<E, T> of liftIOtoEither().
+template<typename T, typename E>
+Either<T, E> runIOtoEither(
+  const IO<T>& io,
+  FunctionRef<E(T)> errorFn,
+  FunctionRef<bool(T)> isError
+  ) {
+  T val = io.run();
+  if (isError(val)) {
+    return Either<T, E>::Left(errorFn(val));
+  }
+  return Either<T, E>::Right(val);
+}
+
 // flatMapIOEither (TaskEither): Unwrap the IO, Inspect the Either,
 //  If it's a Right, call f() (which returns another IO<Either>),
 //  If it's a Left, short-circuit and return that inside a new IO.
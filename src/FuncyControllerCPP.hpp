@@ -7,9 +7,37 @@
 #include "IO.hpp"
 #include "Async.hpp"
 
+// Sequences (depend on Maybe/Either)
+#include "LazySeq.hpp"
+#include "Search.hpp"
+#include "MaybeArray.hpp"
+#include "BatchValidator.hpp"
+#include "Validated.hpp"
+#include "LookupTable.hpp"
+#include "Fixed.hpp"
+#include "Filters.hpp"
+#include "Window.hpp"
+#include "TimeSeries.hpp"
+#include "Memoize.hpp"
+#include "Pipeline.hpp"
+#include "StaticIO.hpp"
+#include "FunctionRef.hpp"
+#include "Zip.hpp"
+#include "Traverse.hpp"
+#include "Sequence.hpp"
+#include "FixedRate.hpp"
+#include "CyclicExecutive.hpp"
+#include "EffectVM.hpp"
+
+// C++20 only (empty otherwise)
+#include "Coroutines.hpp"
+
 // Core Helpers (depend on IO/Either)
 #include "FunctionalHelpers.hpp"
 
+// Optional extern template packs (empty unless FUNCYCONTROLLERCPP_EXTERN_TEMPLATES)
+#include "Instantiations.hpp"
+
 // --- Namespace Alias (Optional Convenience) ---
 // namespace fp = functional_cpp; // Uncomment if you add a namespace
 
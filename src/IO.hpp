@@ -5,20 +5,42 @@
 #include <functional>   // For std::function
 #include <utility>      // For std::move
 #include <type_traits>  // For std::invoke_result_t, decltype
-#include <Arduino.h>    // For String in toString
+#include <Arduino.h>    // For String in toString, millis in cached
+#include "ThinFunction.hpp" // detail::ErasedFunction (std::function unless FUNCYCONTROLLERCPP_THIN_ERASURE)
 
 namespace funcy_controller_cpp {
 
 // Forward Declarations. Important for issues with order definitions!
 template<typename T> class IO;
 template<> class IO<void>; // Important: Declare the specialization
+template<typename T> class Sequence; // Flat then-chains, see Sequence.hpp
+
+// Cache cell for IO::memoize / IO::cached, owned by the caller (global / static).
+// Every IO built with the same cell shares one cached result, however it is
+// copied or combined (map, then, liftIO, ...). invalidate() forces the next run.
+template<typename T>
+struct IOCache {
+  T value = T();
+  unsigned long stamp = 0;   // Time of the last run (cached)
+  bool valid = false;
+
+  void invalidate() { valid = false; }
+};
+
+template<>
+struct IOCache<void> {
+  unsigned long stamp = 0;
+  bool valid = false;
+
+  void invalidate() { valid = false; }
+};
 
 // ==================== IO<T> ====================
 template<typename T>
 class IO {
 public:
   using value_type = T; // Allows deduction in generic flatMap from IO<void>
-  using Func = std::function<T()>;  // The type of the side-effecting computation
+  using Func = detail::ErasedFunction<T()>;  // The type of the side-effecting computation
 
   // Constructor taking the effectful function
   explicit IO(Func func) : effect(func) {}
@@ -66,20 +88,49 @@ public:
     });
   }
 
+  // memoize: Run the effect on the first run() only, return the stored result afterwards
+  // The result lives in cache (caller-owned, must outlive the IO; no allocation for it),
+  // so all copies and all IOs built from the result share it. T needs a default constructor.
+  IO<T> memoize(IOCache<T>& cache) const {
+    return IO<T>([effect = this->effect, cell = &cache]() {
+      if (!cell->valid) {
+        cell->value = effect();
+        cell->valid = true;
+      }
+      return cell->value;
+    });
+  }
+
+  // cached: Like memoize, but run the effect again once ttl has passed since the last run
+  // clock: any callable returning the current time in the unit of ttl (default millis)
+  template<typename Clock = unsigned long (*)()>
+  IO<T> cached(IOCache<T>& cache, unsigned long ttl, Clock clock = millis) const {
+    return IO<T>([effect = this->effect, cell = &cache, ttl, clock]() mutable {
+      const unsigned long now = clock();
+      if (!cell->valid || (unsigned long)(now - cell->stamp) >= ttl) {  // Wrap-around safe
+        cell->value = effect();
+        cell->stamp = now;
+        cell->valid = true;
+      }
+      return cell->value;
+    });
+  }
+
   String toString() const {
     //return "IO<" + String(typeid(T).name()) + "> operation";
     return "IO<T> operation"; // RTTI-disabled friendly for uControllers
   }
 
 private:
-  std::function<T()> effect;
+  template<typename> friend class Sequence;  // Takes the effect without wrapping it
+  detail::ErasedFunction<T()> effect;
 };
 // ==================== IO<void> Specialization ====================
 template<>
 class IO<void> {
 public:
   using value_type = void;
-  using Func = std::function<void()>; // The computation with side effects
+  using Func = detail::ErasedFunction<void()>; // The computation with side effects
 
   explicit IO(Func func) : effect(func) {}
 
@@ -89,7 +140,7 @@ public:
   }
 
   // map: execute side effect, then another side effect
-  IO<void> map(std::function<void()> f) const {
+  IO<void> map(Func f) const {
     return IO<void>([=]() {
       effect();
       f();
@@ -97,7 +148,7 @@ public:
   }
 
   // flatMap: execute side effect, then chain another IO<void>
-  IO<void> flatMap(std::function<IO<void>()> f) const {
+  IO<void> flatMap(detail::ErasedFunction<IO<void>()> f) const {
     return IO<void>([=]() {
       effect();
       f().run();
@@ -123,12 +174,36 @@ public:
     });
   }
 
+  // memoize: Run the effect on the first run() only (see IO<T>::memoize)
+  IO<void> memoize(IOCache<void>& cache) const {
+    return IO<void>([effect = this->effect, cell = &cache]() {
+      if (!cell->valid) {
+        effect();
+        cell->valid = true;
+      }
+    });
+  }
+
+  // cached: Run the effect at most once per ttl (see IO<T>::cached)
+  template<typename Clock = unsigned long (*)()>
+  IO<void> cached(IOCache<void>& cache, unsigned long ttl, Clock clock = millis) const {
+    return IO<void>([effect = this->effect, cell = &cache, ttl, clock]() mutable {
+      const unsigned long now = clock();
+      if (!cell->valid || (unsigned long)(now - cell->stamp) >= ttl) {
+        effect();
+        cell->stamp = now;
+        cell->valid = true;
+      }
+    });
+  }
+
   String toString() const {
     return "IO<void> operation";
   }
 
 private:
-  std::function<void()> effect;
+  template<typename> friend class Sequence;
+  detail::ErasedFunction<void()> effect;
 };
 
 } // namespace funcy_controller_cpp
@@ -0,0 +1,17 @@
+// Explicit instantiations for Instantiations.hpp (empty unless
+// FUNCYCONTROLLERCPP_EXTERN_TEMPLATES is defined for the whole build)
+
+#if defined(FUNCYCONTROLLERCPP_EXTERN_TEMPLATES)
+
+#include "FuncyControllerCPP.hpp"
+
+namespace funcy_controller_cpp {
+
+template class IO<int>;
+template class IO<float>;
+template class IO<bool>;
+template class IO<String>;
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_EXTERN_TEMPLATES
@@ -0,0 +1,35 @@
+// ==================== Explicit instantiation packs ====================
+// Concept:
+//  - Optional: define FUNCYCONTROLLERCPP_EXTERN_TEMPLATES for the whole build
+//    (e.g. build_flags = -DFUNCYCONTROLLERCPP_EXTERN_TEMPLATES, or
+//    arduino-cli --build-property "compiler.cpp.extra_flags=-DFUNCYCONTROLLERCPP_EXTERN_TEMPLATES").
+//  - The common IO types below are then instantiated once in Instantiations.cpp,
+//    every other translation unit only references them (extern template).
+//  - Without the define, this header and Instantiations.cpp are empty.
+// Note:
+//  - Only the non-template members (constructor, run, memoize, thenKeep, ...) are
+//    shared. map / flatMap are member templates instantiated per lambda, they are
+//    still compiled in each sketch.
+//  - Maybe / Either are not in the pack: their members are constexpr (inline) or
+//    templates, and toString() only compiles for String values.
+//  - Measure with extras/benchmarks/instantiation_bench.sh.
+
+#ifndef FUNCYCONTROLLERCPP_INSTANTIATIONS_HPP
+#define FUNCYCONTROLLERCPP_INSTANTIATIONS_HPP
+
+#if defined(FUNCYCONTROLLERCPP_EXTERN_TEMPLATES)
+
+#include "IO.hpp"
+
+namespace funcy_controller_cpp {
+
+extern template class IO<int>;
+extern template class IO<float>;
+extern template class IO<bool>;
+extern template class IO<String>;
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_EXTERN_TEMPLATES
+
+#endif // FUNCYCONTROLLERCPP_INSTANTIATIONS_HPP
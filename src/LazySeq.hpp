@@ -0,0 +1,261 @@
+// ==================== LazySeq<T, Gen> ====================
+// Concept:
+//  - A lazy, range-like view over a sequence of values.
+//  - map, filter, take and scan only describe the work; nothing runs
+//    until a terminal operation (fold, find, head, at, ...) is called.
+//  - All stages are fused into a single pass over the source,
+//    no intermediate std::vector is ever built.
+// Use cases:
+//  - Searching sample buffers (first even value, first value over threshold).
+//  - Running sums / filters over sensor data without extra RAM.
+// Note:
+//  - Gen is the fused stage chain. It is deduced by the factories
+//    (lazySeq(), lazyRange()), so just use auto for the sequence type.
+//  - A LazySeq does not own its source. The buffer must outlive the sequence.
+
+#ifndef FUNCYCONTROLLERCPP_LAZYSEQ_HPP
+#define FUNCYCONTROLLERCPP_LAZYSEQ_HPP
+
+#include <cstddef>      // For size_t
+#include <vector>       // For std::vector sources
+#include <type_traits>  // For std::decay_t
+#include <utility>      // For std::declval
+#include "Maybe.hpp"    // Terminal operations return Maybe
+#include "Either.hpp"   // foldEither returns Either
+
+namespace funcy_controller_cpp {
+
+namespace detail {
+
+// A generator drives a sink with every element: sink(value) -> bool.
+// The sink returns false to stop the pass early (find, head, take, ...).
+
+// Source: contiguous buffer
+template<typename T>
+struct SpanGen {
+  const T* data;
+  size_t size;
+
+  template<typename Sink>
+  void operator()(Sink& sink) const {
+    for (size_t i = 0; i < size; ++i) {
+      if (!sink(data[i])) return;
+    }
+  }
+};
+
+// Source: half-open integer range [from, to)
+template<typename T>
+struct RangeGen {
+  T from;
+  T to;
+
+  template<typename Sink>
+  void operator()(Sink& sink) const {
+    for (T i = from; i < to; ++i) {
+      if (!sink(i)) return;
+    }
+  }
+};
+
+// Stage: transform every element
+template<typename Gen, typename F>
+struct MapGen {
+  Gen gen;
+  F f;
+
+  template<typename Sink>
+  void operator()(Sink& sink) const {
+    auto inner = [&](const auto& value) { return sink(f(value)); };
+    gen(inner);
+  }
+};
+
+// Stage: keep elements matching the predicate
+template<typename Gen, typename P>
+struct FilterGen {
+  Gen gen;
+  P pred;
+
+  template<typename Sink>
+  void operator()(Sink& sink) const {
+    auto inner = [&](const auto& value) { return pred(value) ? sink(value) : true; };
+    gen(inner);
+  }
+};
+
+// Stage: stop after n elements
+template<typename Gen>
+struct TakeGen {
+  Gen gen;
+  size_t n;
+
+  template<typename Sink>
+  void operator()(Sink& sink) const {
+    if (n == 0) return;
+    size_t remaining = n;
+    auto inner = [&](const auto& value) {
+      if (!sink(value)) return false;
+      return --remaining > 0;
+    };
+    gen(inner);
+  }
+};
+
+// Stage: emit the running accumulation acc = f(acc, value)
+template<typename Gen, typename Acc, typename F>
+struct ScanGen {
+  Gen gen;
+  Acc init;
+  F f;
+
+  template<typename Sink>
+  void operator()(Sink& sink) const {
+    Acc acc = init;
+    auto inner = [&](const auto& value) {
+      acc = f(acc, value);
+      return sink(static_cast<const Acc&>(acc));
+    };
+    gen(inner);
+  }
+};
+
+} // namespace detail
+
+template<typename T, typename Gen>
+class LazySeq {
+public:
+  using value_type = T;
+
+  explicit LazySeq(Gen gen) : gen(gen) {}
+
+  // ---------- Lazy stages (return a new LazySeq, nothing runs yet) ----------
+
+  // map: transform every element (T -> U)
+  template<typename F, typename U = std::decay_t<decltype(std::declval<F>()(std::declval<const T&>()))>>
+  LazySeq<U, detail::MapGen<Gen, F>> map(F f) const {
+    return LazySeq<U, detail::MapGen<Gen, F>>(detail::MapGen<Gen, F>{gen, f});
+  }
+
+  // filter: keep elements for which pred(T) is true
+  template<typename P>
+  LazySeq<T, detail::FilterGen<Gen, P>> filter(P pred) const {
+    return LazySeq<T, detail::FilterGen<Gen, P>>(detail::FilterGen<Gen, P>{gen, pred});
+  }
+
+  // take: only the first n elements, the source is not read any further
+  LazySeq<T, detail::TakeGen<Gen>> take(size_t n) const {
+    return LazySeq<T, detail::TakeGen<Gen>>(detail::TakeGen<Gen>{gen, n});
+  }
+
+  // scan: running accumulation ((Acc, T) -> Acc), emits every intermediate Acc
+  // Note: the initial value itself is not emitted.
+  template<typename Acc, typename F>
+  LazySeq<Acc, detail::ScanGen<Gen, Acc, F>> scan(Acc init, F f) const {
+    return LazySeq<Acc, detail::ScanGen<Gen, Acc, F>>(detail::ScanGen<Gen, Acc, F>{gen, init, f});
+  }
+
+  // ---------- Terminal operations (run the fused pass) ----------
+
+  // fold: reduce all elements into a single value ((Acc, T) -> Acc)
+  template<typename Acc, typename F>
+  Acc fold(Acc init, F f) const {
+    Acc acc = init;
+    auto sink = [&](const T& value) {
+      acc = f(acc, value);
+      return true;
+    };
+    gen(sink);
+    return acc;
+  }
+
+  // foldEither: like fold, but f returns Either<Acc, E> ((Acc, T) -> Either<Acc, E>)
+  // Stops at the first Left and returns it.
+  template<typename Acc, typename F,
+           typename Either_AccE = decltype(std::declval<F>()(std::declval<Acc>(), std::declval<const T&>()))>
+  Either_AccE foldEither(Acc init, F f) const {
+    Either_AccE result = Either_AccE::Right(init);
+    auto sink = [&](const T& value) {
+      result = f(result.unwrapRight(), value);
+      return result.isRight();
+    };
+    gen(sink);
+    return result;
+  }
+
+  // find: first element matching pred, or Nothing
+  template<typename P>
+  Maybe<T> find(P pred) const {
+    Maybe<T> result = Maybe<T>::Nothing();
+    auto sink = [&](const T& value) {
+      if (!pred(value)) return true;
+      result = Maybe<T>::Just(value);
+      return false;
+    };
+    gen(sink);
+    return result;
+  }
+
+  // head: first element, or Nothing if the sequence is empty
+  Maybe<T> head() const {
+    return find([](const T&) { return true; });
+  }
+
+  // at: element at position index, or Nothing if the sequence is shorter
+  Maybe<T> at(size_t index) const {
+    size_t i = 0;
+    return find([&](const T&) { return i++ == index; });
+  }
+
+  // count: number of elements
+  size_t count() const {
+    return fold(size_t(0), [](size_t n, const T&) { return n + 1; });
+  }
+
+  // forEach: run a (side-effecting) function for every element
+  template<typename F>
+  void forEach(F f) const {
+    auto sink = [&](const T& value) {
+      f(value);
+      return true;
+    };
+    gen(sink);
+  }
+
+private:
+  Gen gen;
+};
+
+// ==================== Factories ====================
+
+// lazySeq: view over a contiguous buffer (not owned)
+template<typename T>
+LazySeq<T, detail::SpanGen<T>> lazySeq(const T* data, size_t size) {
+  return LazySeq<T, detail::SpanGen<T>>(detail::SpanGen<T>{data, size});
+}
+
+// lazySeq: view over a C array (not owned)
+template<typename T, size_t N>
+LazySeq<T, detail::SpanGen<T>> lazySeq(const T (&data)[N]) {
+  return lazySeq(data, N);
+}
+
+// lazySeq: view over a std::vector (not owned, do not pass a temporary!)
+template<typename T>
+LazySeq<T, detail::SpanGen<T>> lazySeq(const std::vector<T>& data) {
+  return lazySeq(data.data(), data.size());
+}
+
+// A view over a temporary vector would dangle
+template<typename T>
+void lazySeq(const std::vector<T>&& data) = delete;
+
+// lazyRange: the integers [from, to)
+template<typename T>
+LazySeq<T, detail::RangeGen<T>> lazyRange(T from, T to) {
+  return LazySeq<T, detail::RangeGen<T>>(detail::RangeGen<T>{from, to});
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_LAZYSEQ_HPP
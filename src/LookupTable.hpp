@@ -0,0 +1,97 @@
+// ==================== LookupTable<N, T> ====================
+// Concept:
+//  - Sample a pure function f on [lo, hi] into N points at compile time.
+//  - Lookups clamp to the domain and interpolate linearly between points.
+//  - constexpr tables end up in flash / .rodata, nothing runs at startup.
+// Use cases:
+//  - Calibration curves, thermistor curves, gamma tables applied per sample.
+// Usage:
+//  constexpr auto CURVE = makeLookupTable<64>([](float x) { return 0.5f * x * x; }, 0.0f, 3.3f);
+//  io.map(lookup(CURVE));     // drop-in for io.map(curveFunction)
+// Note:
+//  - f must be evaluable at compile time for a constexpr table (no sinf() etc.).
+//    Otherwise build the table at runtime (e.g. in setup()), it then lives in RAM.
+//  - lookup(table) refers to the table, so map closures don't copy N values.
+//    The table must outlive the stage: lookup(makeLookupTable<...>(...)) does not compile.
+//  - lo == hi: every lookup returns f(lo).
+
+#ifndef FUNCYCONTROLLERCPP_LOOKUPTABLE_HPP
+#define FUNCYCONTROLLERCPP_LOOKUPTABLE_HPP
+
+#include <cstddef>      // For size_t
+
+namespace funcy_controller_cpp {
+
+template<size_t N, typename T = float>
+class LookupTable {
+public:
+  static_assert(N >= 2, "LookupTable needs at least 2 points");
+  using value_type = T;
+
+  // generate: sample f at N evenly spaced points of [lo, hi]
+  template<typename F>
+  static constexpr LookupTable generate(F f, T lo, T hi) {
+    LookupTable table;
+    table.lo_ = lo;
+    table.hi_ = hi;
+    table.scale_ = (hi == lo) ? T() : T(N - 1) / (hi - lo);   // Empty domain: no division by zero
+    for (size_t i = 0; i < N; ++i) {
+      table.values_[i] = f(lo + (hi - lo) * T(i) / T(N - 1));
+    }
+    return table;
+  }
+
+  // Interpolated f(x), x is clamped to [lo, hi]
+  constexpr T operator()(T x) const {
+    if (!(x > lo_)) return values_[0];  // also catches NaN
+    if (x >= hi_) return values_[N - 1];
+    const T pos = (x - lo_) * scale_;
+    const size_t i = static_cast<size_t>(pos);
+    if (i >= N - 1) return values_[N - 1];
+    const T frac = pos - T(i);
+    return values_[i] + (values_[i + 1] - values_[i]) * frac;
+  }
+
+  constexpr T lo() const { return lo_; }
+  constexpr T hi() const { return hi_; }
+  constexpr size_t size() const { return N; }
+  constexpr T operator[](size_t i) const { return values_[i]; }
+
+private:
+  T lo_ = T();
+  T hi_ = T();
+  T scale_ = T();
+  T values_[N] = {};
+};
+
+// makeLookupTable: makeLookupTable<N>(f, lo, hi)
+template<size_t N, typename T, typename F>
+constexpr LookupTable<N, T> makeLookupTable(F f, T lo, T hi) {
+  return LookupTable<N, T>::generate(f, lo, hi);
+}
+
+// LookupStage: callable reference to a table, for map stages
+template<size_t N, typename T>
+class LookupStage {
+public:
+  constexpr explicit LookupStage(const LookupTable<N, T>& table) : table(&table) {}
+  explicit LookupStage(const LookupTable<N, T>&& table) = delete;   // Would dangle
+  constexpr T operator()(T x) const { return (*table)(x); }
+
+private:
+  const LookupTable<N, T>* table;
+};
+
+// lookup: use a table as a map stage (Maybe::map, Either::map, IO::map, ...)
+template<size_t N, typename T>
+constexpr LookupStage<N, T> lookup(const LookupTable<N, T>& table) {
+  return LookupStage<N, T>(table);
+}
+
+// Temporary tables are rejected: the stage would point to a destroyed table
+template<size_t N, typename T>
+void lookup(const LookupTable<N, T>&& table) = delete;
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_LOOKUPTABLE_HPP
@@ -6,6 +6,9 @@
 // Use cases:
 //  - Retrieving an item from a collection that might not contain it.
 //  - Parsing a string into a number or a complex object where the result might be invalid.
+// Note:
+//  - Everything except toString() is constexpr: with a literal T (and constexpr
+//    lambdas) Maybe values can be built and inspected at compile time.
 
 #ifndef FUNCYCONTROLLERCPP_MAYBE_HPP 
 #define FUNCYCONTROLLERCPP_MAYBE_HPP 
@@ -15,21 +18,23 @@
 
 namespace funcy_controller_cpp {
 
+namespace detail { template<typename R> struct CoroutineResult; } // See Coroutines.hpp
+
 template<typename T>
 class Maybe {
 public:
   // Constructors
-  static Maybe Just(T value) {
+  static constexpr Maybe Just(T value) {
       return Maybe(value, true);
   }
 
-  static Maybe Nothing() {
+  static constexpr Maybe Nothing() {
       return Maybe(T(), false);
   }
 
   // Introspection
-  bool isJust() const { return hasValue; }
-  bool isNothing() const { return !hasValue; }
+  constexpr bool isJust() const { return hasValue; }
+  constexpr bool isNothing() const { return !hasValue; }
 
   // Accessor
   // WARNING: Unwrapping Nothing is unsafe. Prefer match() or fold().
@@ -39,7 +44,7 @@ public:
 
   // Map: transform Just value
   template<typename F>
-  auto map(F f) const {
+  constexpr auto map(F f) const {
     // Deduce return type R from function f applied to value
     using R = decltype(f(value));
     if (hasValue) return Maybe<R>::Just(f(value));
@@ -48,7 +53,7 @@ public:
 
   // FlatMap (bind): transform Just value into another Maybe
   template<typename F>
-  auto flatMap(F f) const {
+  constexpr auto flatMap(F f) const {
     // Deduce the return type (which must be a Maybe<...>)
     using Ret = decltype(f(value));
     if (hasValue) return f(value);
@@ -63,7 +68,7 @@ public:
   // Match: pattern-match both sides, 
   // handle both Just and Nothing cases separately
   template<typename JustFn, typename NothingFn>
-  auto match(JustFn onJust, NothingFn onNothing) const {
+  constexpr auto match(JustFn onJust, NothingFn onNothing) const {
     // Result type is deduced from the return types of onJust and onNothing
     // Note: They should ideally return the same type or compatible types.
     return hasValue ? onJust(value) : onNothing();
@@ -72,12 +77,17 @@ public:
   // Fold: convert to a value (default if Nothing)
   // combines the results from both cases (Just OR Nothing) into a single value
   template<typename JustFn, typename NothingFn>
-  auto fold(JustFn onJust, NothingFn onNothing) const {
+  constexpr auto fold(JustFn onJust, NothingFn onNothing) const {
     // Result type is deduced from the return types of onJust and onNothing
     // Note: They must return the same type or compatible types.
     return hasValue ? onJust(value) : onNothing();
   }
 
+#if defined(__cpp_impl_coroutine)
+  // Coroutine support: result of a co_await function (see Coroutines.hpp)
+  Maybe(detail::CoroutineResult<Maybe>&& result);
+#endif
+
   // Debug toString
   String toString() const {
     // Note: Requires T to be convertible to String, or have operator<< overloaded
@@ -90,7 +100,7 @@ private:
   T value;
   bool hasValue;
 
-  Maybe(T val, bool isJust)
+  constexpr Maybe(T val, bool isJust)
     : value(val), hasValue(isJust) {}
 };
 
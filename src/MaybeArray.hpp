@@ -0,0 +1,184 @@
+// ==================== MaybeArray<T> ====================
+// Concept:
+//  - An array of Maybe<T> stored as structure-of-arrays:
+//    the values are contiguous, the Just/Nothing flags live in a packed
+//    validity bitmap (1 bit per element, like Apache Arrow).
+//  - Bulk operations (map, fold, count, fillNothing) work on 64 elements
+//    per bitmap word: all-Nothing words are skipped, all-Just words run a
+//    dense loop over the values, which the compiler can vectorize.
+// Use cases:
+//  - Buffers of optional sensor samples (std::vector<Maybe<float>> needs
+//    8 bytes per float sample because of the flag and padding, this needs ~4.1).
+// Note:
+//  - Nothing slots hold T(). Bits behind size() are always 0.
+
+#ifndef FUNCYCONTROLLERCPP_MAYBEARRAY_HPP
+#define FUNCYCONTROLLERCPP_MAYBEARRAY_HPP
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For uint64_t
+#include <vector>       // For the value and bitmap storage
+#include <type_traits>  // For std::decay_t
+#include <utility>      // For std::declval
+#include "Maybe.hpp"    // Element access returns Maybe
+
+namespace funcy_controller_cpp {
+
+namespace detail {
+
+inline unsigned countTrailingZeros64(uint64_t word) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(word);
+#else
+  unsigned n = 0;
+  while (!(word & 1)) { word >>= 1; ++n; }
+  return n;
+#endif
+}
+
+inline unsigned popCount64(uint64_t word) {
+#if defined(__GNUC__)
+  return __builtin_popcountll(word);
+#else
+  unsigned n = 0;
+  for (; word; word &= word - 1) ++n;
+  return n;
+#endif
+}
+
+} // namespace detail
+
+template<typename T>
+class MaybeArray {
+public:
+  using value_type = T;
+
+  // Constructors: size elements, all Nothing
+  explicit MaybeArray(size_t size = 0)
+    : values_(size, T()), validity_(wordCount(size), 0), size_(size) {}
+
+  static MaybeArray fromMaybes(const std::vector<Maybe<T>>& maybes) {
+    MaybeArray result(maybes.size());
+    for (size_t i = 0; i < maybes.size(); ++i) {
+      maybes[i].fold(
+        [&](T value) { result.setJust(i, value); },
+        []() {}
+      );
+    }
+    return result;
+  }
+
+  // Introspection
+  size_t size() const { return size_; }
+  bool isJust(size_t i) const { return i < size_ && ((validity_[i / 64] >> (i % 64)) & 1); }
+  bool isNothing(size_t i) const { return !isJust(i); }
+
+  // Element access: Nothing if the slot is empty or out of range
+  Maybe<T> get(size_t i) const {
+    return isJust(i) ? Maybe<T>::Just(values_[i]) : Maybe<T>::Nothing();
+  }
+
+  // Element update (out of range indices are ignored)
+  void setJust(size_t i, T value) {
+    if (i >= size_) return;
+    values_[i] = value;
+    validity_[i / 64] |= uint64_t(1) << (i % 64);
+  }
+
+  void setNothing(size_t i) {
+    if (i >= size_) return;
+    values_[i] = T();
+    validity_[i / 64] &= ~(uint64_t(1) << (i % 64));
+  }
+
+  // Raw access to the columns (for DMA, logging, custom kernels)
+  const T* values() const { return values_.data(); }
+  const uint64_t* validity() const { return validity_.data(); }
+
+  // count: number of Just elements (popcount per bitmap word)
+  size_t count() const {
+    size_t n = 0;
+    for (uint64_t word : validity_) n += detail::popCount64(word);
+    return n;
+  }
+
+  // map: transform every Just value (T -> U), Nothing stays Nothing
+  template<typename F, typename U = std::decay_t<decltype(std::declval<F>()(std::declval<const T&>()))>>
+  MaybeArray<U> map(F f) const {
+    MaybeArray<U> result(size_);
+    result.validity_ = validity_;
+    U* out = result.values_.data();
+    const T* in = values_.data();
+    forEachJust(
+      [&](size_t begin, size_t end) { for (size_t i = begin; i < end; ++i) out[i] = f(in[i]); },
+      [&](size_t i) { out[i] = f(in[i]); }
+    );
+    return result;
+  }
+
+  // fold: reduce all Just values ((Acc, T) -> Acc), Nothing is skipped
+  template<typename Acc, typename F>
+  Acc fold(Acc init, F f) const {
+    Acc acc = init;
+    const T* in = values_.data();
+    forEachJust(
+      [&](size_t begin, size_t end) { for (size_t i = begin; i < end; ++i) acc = f(acc, in[i]); },
+      [&](size_t i) { acc = f(acc, in[i]); }
+    );
+    return acc;
+  }
+
+  // fillNothing: replace every Nothing with fallback, the result is all Just
+  MaybeArray fillNothing(T fallback) const {
+    MaybeArray result(*this);
+    T* out = result.values_.data();
+    for (size_t w = 0; w < validity_.size(); ++w) {
+      const uint64_t word = validity_[w];
+      const size_t begin = w * 64;
+      const size_t n = blockSize(begin);
+      if (word == fullMask(n)) continue;
+      // Branch-free select over the block, vectorizable
+      for (size_t bit = 0; bit < n; ++bit) {
+        out[begin + bit] = ((word >> bit) & 1) ? out[begin + bit] : fallback;
+      }
+      result.validity_[w] = fullMask(n);
+    }
+    return result;
+  }
+
+private:
+  template<typename> friend class MaybeArray;
+
+  std::vector<T> values_;
+  std::vector<uint64_t> validity_;
+  size_t size_;
+
+  static size_t wordCount(size_t size) { return (size + 63) / 64; }
+  static uint64_t fullMask(size_t n) { return (n >= 64) ? ~uint64_t(0) : ((uint64_t(1) << n) - 1); }
+  size_t blockSize(size_t begin) const { return (size_ - begin < 64) ? size_ - begin : 64; }
+
+  // Visit the Just elements word by word:
+  //  - all Nothing: skipped
+  //  - all Just: dense(begin, end) over the whole block
+  //  - mixed: sparse(i) for every set bit
+  template<typename Dense, typename Sparse>
+  void forEachJust(Dense dense, Sparse sparse) const {
+    for (size_t w = 0; w < validity_.size(); ++w) {
+      uint64_t word = validity_[w];
+      if (word == 0) continue;
+      const size_t begin = w * 64;
+      const size_t n = blockSize(begin);
+      if (word == fullMask(n)) {
+        dense(begin, begin + n);
+        continue;
+      }
+      for (; word; word &= word - 1) {
+        sparse(begin + detail::countTrailingZeros64(word));
+      }
+    }
+  }
+};
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_MAYBEARRAY_HPP
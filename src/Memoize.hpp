@@ -0,0 +1,180 @@
+// ==================== memoize<N>(f) ====================
+// Concept:
+//  - Wraps a pure unary function in a fixed-capacity cache of N entries (inline, no heap).
+//  - Open addressing with a short linear probe window. On a miss in a full window the
+//    least recently used entry of the window is replaced (LRU per window).
+//  - Optional hit / miss counters: memoize<N, true>(f).
+//  - The cache is not copyable (a copy would silently start empty), use it as a
+//    map stage via stage(), like the streaming filters:
+//      auto calibrate = memoize<64>(polynomial);   // global / static, not in loop()!
+//      readAdc().map(stage(calibrate));
+//      Maybe<int>::Just(raw).map(stage(calibrate));
+// Note:
+//  - Only for pure functions: the result must depend on the argument alone.
+//  - Keys are hashed with memoHash(): integers, floats, pointers and String are
+//    supported, other key types need a memoHash(const Key&) overload.
+//  - The table itself never allocates; String keys still own their heap buffer.
+//  - A lookup costs a hash plus up to 8 probes: worth it when f is clearly more
+//    expensive than that (soft-float math, parsing) and inputs repeat.
+
+#ifndef FUNCYCONTROLLERCPP_MEMOIZE_HPP
+#define FUNCYCONTROLLERCPP_MEMOIZE_HPP
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For uint32_t
+#include <cstring>      // For memcpy
+#include <type_traits>  // For std::decay_t, std::conditional_t
+#include <Arduino.h>    // For String keys
+
+namespace funcy_controller_cpp {
+
+// ==================== memoHash ====================
+template<typename K, typename = std::enable_if_t<std::is_integral<K>::value || std::is_enum<K>::value>>
+inline uint32_t memoHash(K key) {
+  uint32_t h = uint32_t(key) ^ uint32_t(uint64_t(key) >> 32);
+  h ^= h >> 16;
+  h *= 0x7FEB352Du;
+  h ^= h >> 15;
+  h *= 0x846CA68Bu;
+  h ^= h >> 16;
+  return h;
+}
+
+inline uint32_t memoHash(float key) {
+  uint32_t bits;
+  if (key == 0.0f) key = 0.0f;  // -0.0f == 0.0f: same hash
+  memcpy(&bits, &key, sizeof(bits));
+  return memoHash(bits);
+}
+
+inline uint32_t memoHash(double key) {
+  uint64_t bits;
+  if (key == 0.0) key = 0.0;
+  memcpy(&bits, &key, sizeof(bits));
+  return memoHash(bits);
+}
+
+template<typename P>
+inline uint32_t memoHash(P* key) {
+  return memoHash(uintptr_t(key));
+}
+
+// FNV-1a
+inline uint32_t memoHash(const String& key) {
+  uint32_t h = 2166136261u;
+  for (unsigned i = 0; i < key.length(); ++i) {
+    h ^= uint8_t(key[i]);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+namespace detail {
+
+// Argument / result type of a unary function pointer or non-generic lambda
+template<typename F> struct UnaryTraits : UnaryTraits<decltype(&F::operator())> {};
+template<typename R, typename A> struct UnaryTraits<R (*)(A)> { using arg = A; using result = R; };
+template<typename R, typename A> struct UnaryTraits<R (&)(A)> { using arg = A; using result = R; };
+template<typename R, typename A> struct UnaryTraits<R(A)> { using arg = A; using result = R; };
+template<typename C, typename R, typename A> struct UnaryTraits<R (C::*)(A) const> { using arg = A; using result = R; };
+template<typename C, typename R, typename A> struct UnaryTraits<R (C::*)(A)> { using arg = A; using result = R; };
+
+struct MemoCounters {
+  size_t hits = 0;
+  size_t misses = 0;
+};
+struct NoMemoCounters {};
+
+} // namespace detail
+
+// ==================== Memoized ====================
+template<size_t N, typename F, typename Key, typename Result, bool Counters = false>
+class Memoized {
+public:
+  static_assert(N > 0 && (N & (N - 1)) == 0, "memoize<N>: N must be a power of two");
+
+  // Slots searched per lookup (the LRU window)
+  static constexpr size_t probeWindow = (N < 8) ? N : 8;
+
+  explicit Memoized(F f) : f(f) {}
+
+  Memoized(const Memoized&) = delete;
+  Memoized& operator=(const Memoized&) = delete;
+
+  Result operator()(const Key& key) {
+    ++tick;
+    const uint32_t hash = memoHash(key);
+    const size_t home = hash & (N - 1);
+    size_t victim = home;
+    for (size_t p = 0; p < probeWindow; ++p) {
+      Entry& e = entries[(home + p) & (N - 1)];
+      if (!e.used) {
+        victim = (home + p) & (N - 1);
+        break;
+      }
+      if (e.hash == hash && e.key == key) {
+        e.lastUse = tick;
+        countHit();
+        return e.value;
+      }
+      // Oldest so far (tick differences are wrap-around safe)
+      if (tick - e.lastUse > tick - entries[victim].lastUse) victim = (home + p) & (N - 1);
+    }
+
+    countMiss();
+    Entry& e = entries[victim];
+    e.key = key;
+    e.hash = hash;
+    e.value = f(key);
+    e.lastUse = tick;
+    e.used = true;
+    return e.value;
+  }
+
+  template<bool C = Counters, typename = std::enable_if_t<C>>
+  size_t hits() const { return counters.hits; }
+
+  template<bool C = Counters, typename = std::enable_if_t<C>>
+  size_t misses() const { return counters.misses; }
+
+  static constexpr size_t capacity() { return N; }
+
+  void clear() {
+    for (Entry& e : entries) e.used = false;
+    counters = CounterType();
+  }
+
+private:
+  struct Entry {
+    Key key = Key();
+    Result value = Result();
+    uint32_t hash = 0;      // Compared before the (possibly expensive) key
+    uint32_t lastUse = 0;
+    bool used = false;
+  };
+
+  using CounterType = std::conditional_t<Counters, detail::MemoCounters, detail::NoMemoCounters>;
+
+  F f;
+  Entry entries[N];
+  uint32_t tick = 0;
+  CounterType counters;
+
+  template<bool C = Counters> std::enable_if_t<C> countHit() { ++counters.hits; }
+  template<bool C = Counters> std::enable_if_t<!C> countHit() {}
+  template<bool C = Counters> std::enable_if_t<C> countMiss() { ++counters.misses; }
+  template<bool C = Counters> std::enable_if_t<!C> countMiss() {}
+};
+
+// memoize<N>(f) / memoize<N, true>(f) (with hit / miss counters)
+template<size_t N, bool Counters = false, typename F,
+         typename Traits = detail::UnaryTraits<std::decay_t<F>>>
+Memoized<N, std::decay_t<F>, std::decay_t<typename Traits::arg>, std::decay_t<typename Traits::result>, Counters>
+memoize(F f) {
+  return Memoized<N, std::decay_t<F>, std::decay_t<typename Traits::arg>,
+                  std::decay_t<typename Traits::result>, Counters>(f);
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_MEMOIZE_HPP
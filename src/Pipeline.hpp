@@ -0,0 +1,169 @@
+// ==================== Pipeline<In, Stages> ====================
+// Concept:
+//  - A chain of stages built once (e.g. at global scope or in setup()) and run
+//    many times with run(input). The input is a parameter, not a capture.
+//  - The stages are stored by value inside the Pipeline object, composed at compile
+//    time: no std::function, no allocation, no closure construction per run.
+//  - Stateful stages (filters, window statistics, ...) are owned by the pipeline
+//    and keep their state between runs.
+//  - Stages:
+//      map(f)      x -> f(x)
+//      flatMap(f)  Maybe / Either x -> x.flatMap(f) (short-circuits),
+//                  plain x with f returning IO -> f(x).run()
+//      tap(f)      calls f(x) for its side effect, passes x on
+// Usage:
+//  auto calibrate = pipeline<int>()                // global, built once
+//    .map([](int raw) { return raw * 0.0806f; })
+//    .map(Ema<float>(0.1f))
+//    .map([](float mv) { return mv > 300 ? Maybe<float>::Nothing() : Maybe<float>::Just(mv); });
+//  void loop() { calibrate.run(analogRead(A0)).match(...); }
+//  A Pipeline is itself a stage: readAdc().map(stage(calibrate))
+//  Pipelines of stateless stages (function pointers, captureless lambdas) can be
+//  constexpr and are run through the const run() (see StaticIO.hpp).
+
+#ifndef FUNCYCONTROLLERCPP_PIPELINE_HPP
+#define FUNCYCONTROLLERCPP_PIPELINE_HPP
+
+#include <functional>   // For std::ref
+#include <type_traits>  // For std::decay_t, std::enable_if_t
+#include <utility>      // For std::move, std::declval
+#include "IO.hpp"       // flatMap runs IO results
+
+namespace funcy_controller_cpp {
+
+namespace detail {
+
+template<typename X> struct IsIO : std::false_type {};
+template<typename T> struct IsIO<IO<T>> : std::true_type {};
+
+struct IdentityStage {
+  template<typename X>
+  constexpr const X& operator()(const X& x) const { return x; }
+};
+
+template<typename Prev, typename G>
+struct MapStage {
+  Prev prev;
+  G g;
+
+  template<typename X>
+  auto operator()(const X& x) { return g(prev(x)); }
+
+  // const: for constexpr pipelines of stateless stages
+  template<typename X>
+  constexpr auto operator()(const X& x) const { return g(prev(x)); }
+};
+
+template<typename Prev, typename G>
+struct TapStage {
+  Prev prev;
+  G g;
+
+  template<typename X>
+  auto operator()(const X& x) {
+    auto y = prev(x);
+    g(y);
+    return y;
+  }
+
+  template<typename X>
+  constexpr auto operator()(const X& x) const {
+    auto y = prev(x);
+    g(y);
+    return y;
+  }
+};
+
+template<typename Prev, typename G>
+struct FlatMapStage {
+  Prev prev;
+  G g;
+
+  template<typename X>
+  auto operator()(const X& x) { return bind(prev(x)); }
+
+  template<typename X>
+  constexpr auto operator()(const X& x) const { return bindConst(prev(x)); }
+
+private:
+  // Maybe / Either: g by reference, so stateful stages keep their state
+  template<typename Y>
+  auto bind(const Y& y) -> decltype(y.flatMap(std::ref(g))) { return y.flatMap(std::ref(g)); }
+
+  // Plain value, g returns an IO: run it now
+  template<typename Y, typename R = decltype(std::declval<G&>()(std::declval<const Y&>()))>
+  auto bind(const Y& y, ...) -> std::enable_if_t<IsIO<R>::value, typename R::value_type> {
+    return g(y).run();
+  }
+
+  // const: g is stateless, a copy is as good as a reference
+  template<typename Y>
+  constexpr auto bindConst(const Y& y) const -> decltype(y.flatMap(g)) { return y.flatMap(g); }
+
+  template<typename Y, typename R = decltype(std::declval<const G&>()(std::declval<const Y&>()))>
+  auto bindConst(const Y& y, ...) const -> std::enable_if_t<IsIO<R>::value, typename R::value_type> {
+    return g(y).run();
+  }
+};
+
+} // namespace detail
+
+template<typename In, typename Stages = detail::IdentityStage>
+class Pipeline {
+public:
+  using input_type = In;
+  using output_type = std::decay_t<decltype(std::declval<Stages&>()(std::declval<const In&>()))>;
+
+  constexpr Pipeline() = default;
+  constexpr explicit Pipeline(Stages stages) : stages(std::move(stages)) {}
+
+  // Run all stages on input (non-const: stages may keep state)
+  output_type run(const In& input) { return stages(input); }
+
+  // const / constexpr pipelines: all stages must be const-callable (stateless)
+  constexpr output_type run(const In& input) const { return stages(input); }
+
+  // A pipeline is a stage itself (use stage(pipeline) in IO / Maybe / Either::map)
+  output_type operator()(const In& input) { return stages(input); }
+  constexpr output_type operator()(const In& input) const { return stages(input); }
+
+  template<typename G>
+  constexpr Pipeline<In, detail::MapStage<Stages, G>> map(G g) const& {
+    return Pipeline<In, detail::MapStage<Stages, G>>({stages, std::move(g)});
+  }
+  template<typename G>
+  constexpr Pipeline<In, detail::MapStage<Stages, G>> map(G g) && {
+    return Pipeline<In, detail::MapStage<Stages, G>>({std::move(stages), std::move(g)});
+  }
+
+  template<typename G>
+  constexpr Pipeline<In, detail::FlatMapStage<Stages, G>> flatMap(G g) const& {
+    return Pipeline<In, detail::FlatMapStage<Stages, G>>({stages, std::move(g)});
+  }
+  template<typename G>
+  constexpr Pipeline<In, detail::FlatMapStage<Stages, G>> flatMap(G g) && {
+    return Pipeline<In, detail::FlatMapStage<Stages, G>>({std::move(stages), std::move(g)});
+  }
+
+  template<typename G>
+  constexpr Pipeline<In, detail::TapStage<Stages, G>> tap(G g) const& {
+    return Pipeline<In, detail::TapStage<Stages, G>>({stages, std::move(g)});
+  }
+  template<typename G>
+  constexpr Pipeline<In, detail::TapStage<Stages, G>> tap(G g) && {
+    return Pipeline<In, detail::TapStage<Stages, G>>({std::move(stages), std::move(g)});
+  }
+
+private:
+  Stages stages;
+};
+
+// Start a pipeline taking In
+template<typename In>
+constexpr Pipeline<In> pipeline() {
+  return Pipeline<In>();
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_PIPELINE_HPP
@@ -0,0 +1,310 @@
+// ==================== Search kernels ====================
+// Concept:
+//  - findFirst / findLast: first / last element matching a predicate -> Maybe<T>
+//  - findFirstIndex / findLastIndex / indexOf: position of a match -> Maybe<size_t>
+//  - Works on contiguous buffers (pointer + size, C arrays, std::vector).
+// Use cases:
+//  - First sample over a threshold, first error code in a buffer.
+// Performance:
+//  - Any callable works as predicate (scalar loop).
+//  - The comparison predicates below (equalTo, greaterThan, ...) on int32_t and
+//    float buffers use SSE2 / AVX2 on x86 hosts. Other targets use the scalar loop.
+//  - Measured with examples/search/search.ino (x86-64, g++ 12, float, findFirstIndex
+//    with greaterThan, match at the end). Buffers that fit in cache: -O2 SSE2 about
+//    3x the scalar loop (19 vs 6.5 GB/s), AVX2 (-mavx2) about 6x (38 GB/s); -Os
+//    SSE2 about 2x (10 vs 4.6 GB/s). At 64 MB all of them are memory bound (about
+//    7 vs 5 GB/s).
+
+#ifndef FUNCYCONTROLLERCPP_SEARCH_HPP
+#define FUNCYCONTROLLERCPP_SEARCH_HPP
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For int32_t
+#include <vector>       // For std::vector overloads
+#include <type_traits>  // For std::common_type_t
+#include "Maybe.hpp"    // Results are Maybe
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#define FUNCYCONTROLLERCPP_SEARCH_SSE2 1
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define FUNCYCONTROLLERCPP_SEARCH_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+namespace funcy_controller_cpp {
+
+// ==================== Comparison predicates ====================
+enum class Cmp { Eq, Ne, Lt, Le, Gt, Ge };
+
+template<typename T, Cmp C>
+struct Compare {
+  T value;
+
+  bool operator()(const T& x) const {
+    switch (C) {
+      case Cmp::Eq: return x == value;
+      case Cmp::Ne: return x != value;
+      case Cmp::Lt: return x < value;
+      case Cmp::Le: return x <= value;
+      case Cmp::Gt: return x > value;
+      case Cmp::Ge: return x >= value;
+    }
+    return false;
+  }
+};
+
+template<typename T> Compare<T, Cmp::Eq> equalTo(T value) { return {value}; }
+template<typename T> Compare<T, Cmp::Ne> notEqualTo(T value) { return {value}; }
+template<typename T> Compare<T, Cmp::Lt> lessThan(T value) { return {value}; }
+template<typename T> Compare<T, Cmp::Le> lessEqual(T value) { return {value}; }
+template<typename T> Compare<T, Cmp::Gt> greaterThan(T value) { return {value}; }
+template<typename T> Compare<T, Cmp::Ge> greaterEqual(T value) { return {value}; }
+
+namespace detail {
+
+// ==================== Scalar kernels ====================
+// Return the matching index, or size if there is no match
+
+template<typename T, typename Pred>
+size_t firstMatch(const T* data, size_t size, const Pred& pred) {
+  for (size_t i = 0; i < size; ++i) {
+    if (pred(data[i])) return i;
+  }
+  return size;
+}
+
+template<typename T, typename Pred>
+size_t lastMatch(const T* data, size_t size, const Pred& pred) {
+  for (size_t i = size; i > 0; --i) {
+    if (pred(data[i - 1])) return i - 1;
+  }
+  return size;
+}
+
+#if defined(FUNCYCONTROLLERCPP_SEARCH_SSE2)
+// ==================== SIMD kernels ====================
+
+// Compare all lanes against ref, one bit per lane in the result
+template<Cmp C>
+inline int laneMask(__m128i v, __m128i ref) {
+  switch (C) {
+    case Cmp::Eq: return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, ref)));
+    case Cmp::Ne: return ~laneMask<Cmp::Eq>(v, ref) & 0xF;
+    case Cmp::Lt: return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, ref)));
+    case Cmp::Le: return ~laneMask<Cmp::Gt>(v, ref) & 0xF;
+    case Cmp::Gt: return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, ref)));
+    case Cmp::Ge: return ~laneMask<Cmp::Lt>(v, ref) & 0xF;
+  }
+  return 0;
+}
+
+template<Cmp C>
+inline int laneMask(__m128 v, __m128 ref) {
+  switch (C) {
+    case Cmp::Eq: return _mm_movemask_ps(_mm_cmpeq_ps(v, ref));
+    case Cmp::Ne: return _mm_movemask_ps(_mm_cmpneq_ps(v, ref));
+    case Cmp::Lt: return _mm_movemask_ps(_mm_cmplt_ps(v, ref));
+    case Cmp::Le: return _mm_movemask_ps(_mm_cmple_ps(v, ref));
+    case Cmp::Gt: return _mm_movemask_ps(_mm_cmpgt_ps(v, ref));
+    case Cmp::Ge: return _mm_movemask_ps(_mm_cmpge_ps(v, ref));
+  }
+  return 0;
+}
+
+#if defined(FUNCYCONTROLLERCPP_SEARCH_AVX2)
+template<Cmp C>
+inline int laneMask(__m256i v, __m256i ref) {
+  switch (C) {
+    case Cmp::Eq: return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, ref)));
+    case Cmp::Ne: return ~laneMask<Cmp::Eq>(v, ref) & 0xFF;
+    case Cmp::Lt: return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(ref, v)));
+    case Cmp::Le: return ~laneMask<Cmp::Gt>(v, ref) & 0xFF;
+    case Cmp::Gt: return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, ref)));
+    case Cmp::Ge: return ~laneMask<Cmp::Lt>(v, ref) & 0xFF;
+  }
+  return 0;
+}
+
+template<Cmp C>
+inline int laneMask(__m256 v, __m256 ref) {
+  switch (C) {
+    case Cmp::Eq: return _mm256_movemask_ps(_mm256_cmp_ps(v, ref, _CMP_EQ_OQ));
+    case Cmp::Ne: return _mm256_movemask_ps(_mm256_cmp_ps(v, ref, _CMP_NEQ_UQ));
+    case Cmp::Lt: return _mm256_movemask_ps(_mm256_cmp_ps(v, ref, _CMP_LT_OQ));
+    case Cmp::Le: return _mm256_movemask_ps(_mm256_cmp_ps(v, ref, _CMP_LE_OQ));
+    case Cmp::Gt: return _mm256_movemask_ps(_mm256_cmp_ps(v, ref, _CMP_GT_OQ));
+    case Cmp::Ge: return _mm256_movemask_ps(_mm256_cmp_ps(v, ref, _CMP_GE_OQ));
+  }
+  return 0;
+}
+#endif
+
+// Load / broadcast helpers per element type
+struct Int32Lanes {
+  using T = int32_t;
+  static __m128i load4(const T* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+  static __m128i splat4(T v) { return _mm_set1_epi32(v); }
+#if defined(FUNCYCONTROLLERCPP_SEARCH_AVX2)
+  static __m256i load8(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+  static __m256i splat8(T v) { return _mm256_set1_epi32(v); }
+#endif
+};
+
+struct FloatLanes {
+  using T = float;
+  static __m128 load4(const T* p) { return _mm_loadu_ps(p); }
+  static __m128 splat4(T v) { return _mm_set1_ps(v); }
+#if defined(FUNCYCONTROLLERCPP_SEARCH_AVX2)
+  static __m256 load8(const T* p) { return _mm256_loadu_ps(p); }
+  static __m256 splat8(T v) { return _mm256_set1_ps(v); }
+#endif
+};
+
+template<typename Lanes, Cmp C>
+size_t simdFirstMatch(const typename Lanes::T* data, size_t size, typename Lanes::T value) {
+  size_t i = 0;
+#if defined(FUNCYCONTROLLERCPP_SEARCH_AVX2)
+  const auto ref8 = Lanes::splat8(value);
+  for (; i + 8 <= size; i += 8) {
+    int mask = laneMask<C>(Lanes::load8(data + i), ref8);
+    if (mask) return i + __builtin_ctz(mask);
+  }
+#endif
+  const auto ref4 = Lanes::splat4(value);
+  for (; i + 4 <= size; i += 4) {
+    int mask = laneMask<C>(Lanes::load4(data + i), ref4);
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  const Compare<typename Lanes::T, C> pred{value};
+  for (; i < size; ++i) {
+    if (pred(data[i])) return i;
+  }
+  return size;
+}
+
+template<typename Lanes, Cmp C>
+size_t simdLastMatch(const typename Lanes::T* data, size_t size, typename Lanes::T value) {
+#if defined(FUNCYCONTROLLERCPP_SEARCH_AVX2)
+  const size_t width = 8;
+#else
+  const size_t width = 4;
+#endif
+  // Scalar tail first (everything behind the last full block)
+  size_t i = size - size % width;
+  const Compare<typename Lanes::T, C> pred{value};
+  for (size_t j = size; j > i; --j) {
+    if (pred(data[j - 1])) return j - 1;
+  }
+#if defined(FUNCYCONTROLLERCPP_SEARCH_AVX2)
+  const auto ref = Lanes::splat8(value);
+  for (; i > 0; i -= 8) {
+    int mask = laneMask<C>(Lanes::load8(data + i - 8), ref);
+    if (mask) return i - 8 + (31 - __builtin_clz(mask));
+  }
+#else
+  const auto ref = Lanes::splat4(value);
+  for (; i > 0; i -= 4) {
+    int mask = laneMask<C>(Lanes::load4(data + i - 4), ref);
+    if (mask) return i - 4 + (31 - __builtin_clz(mask));
+  }
+#endif
+  return size;
+}
+
+// More specialized overloads: picked over the scalar kernels for comparison predicates
+template<Cmp C>
+size_t firstMatch(const int32_t* data, size_t size, const Compare<int32_t, C>& pred) {
+  return simdFirstMatch<Int32Lanes, C>(data, size, pred.value);
+}
+
+template<Cmp C>
+size_t firstMatch(const float* data, size_t size, const Compare<float, C>& pred) {
+  return simdFirstMatch<FloatLanes, C>(data, size, pred.value);
+}
+
+template<Cmp C>
+size_t lastMatch(const int32_t* data, size_t size, const Compare<int32_t, C>& pred) {
+  return simdLastMatch<Int32Lanes, C>(data, size, pred.value);
+}
+
+template<Cmp C>
+size_t lastMatch(const float* data, size_t size, const Compare<float, C>& pred) {
+  return simdLastMatch<FloatLanes, C>(data, size, pred.value);
+}
+#endif // FUNCYCONTROLLERCPP_SEARCH_SSE2
+
+inline Maybe<size_t> indexResult(size_t index, size_t size) {
+  return (index < size) ? Maybe<size_t>::Just(index) : Maybe<size_t>::Nothing();
+}
+
+} // namespace detail
+
+// ==================== Index searches -> Maybe<size_t> ====================
+
+// findFirstIndex: position of the first element matching pred
+template<typename T, typename Pred>
+Maybe<size_t> findFirstIndex(const T* data, size_t size, Pred pred) {
+  return detail::indexResult(detail::firstMatch(data, size, pred), size);
+}
+
+// findLastIndex: position of the last element matching pred
+template<typename T, typename Pred>
+Maybe<size_t> findLastIndex(const T* data, size_t size, Pred pred) {
+  return detail::indexResult(detail::lastMatch(data, size, pred), size);
+}
+
+// indexOf: position of the first element equal to value
+// (value is not deduced, so indexOf(floats, n, 0) works)
+template<typename T>
+Maybe<size_t> indexOf(const T* data, size_t size, const std::common_type_t<T>& value) {
+  return findFirstIndex(data, size, equalTo<T>(value));
+}
+
+// ==================== Element searches -> Maybe<T> ====================
+
+// findFirst: first element matching pred
+template<typename T, typename Pred>
+Maybe<T> findFirst(const T* data, size_t size, Pred pred) {
+  size_t i = detail::firstMatch(data, size, pred);
+  return (i < size) ? Maybe<T>::Just(data[i]) : Maybe<T>::Nothing();
+}
+
+// findLast: last element matching pred
+template<typename T, typename Pred>
+Maybe<T> findLast(const T* data, size_t size, Pred pred) {
+  size_t i = detail::lastMatch(data, size, pred);
+  return (i < size) ? Maybe<T>::Just(data[i]) : Maybe<T>::Nothing();
+}
+
+// ==================== std::vector overloads ====================
+
+template<typename T, typename Pred>
+Maybe<size_t> findFirstIndex(const std::vector<T>& data, Pred pred) {
+  return findFirstIndex(data.data(), data.size(), pred);
+}
+
+template<typename T, typename Pred>
+Maybe<size_t> findLastIndex(const std::vector<T>& data, Pred pred) {
+  return findLastIndex(data.data(), data.size(), pred);
+}
+
+template<typename T>
+Maybe<size_t> indexOf(const std::vector<T>& data, const std::common_type_t<T>& value) {
+  return indexOf(data.data(), data.size(), value);
+}
+
+template<typename T, typename Pred>
+Maybe<T> findFirst(const std::vector<T>& data, Pred pred) {
+  return findFirst(data.data(), data.size(), pred);
+}
+
+template<typename T, typename Pred>
+Maybe<T> findLast(const std::vector<T>& data, Pred pred) {
+  return findLast(data.data(), data.size(), pred);
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_SEARCH_HPP
@@ -0,0 +1,89 @@
+// ==================== Sequence<T> ====================
+// Concept:
+//  - A flat then-chain: a.then(b).then(c) on IO nests one closure per then, so
+//    running it is a chain of nested calls. A Sequence keeps the effects side by
+//    side in one contiguous array and runs them in a plain loop.
+//  - The effects of the IOs are taken over as they are (no wrapper closure): one
+//    indirect call per IO<void> effect. Effects whose result is discarded (a non-void
+//    IO followed by then) get one small adapter.
+//  - The result is the result of the last effect, like IO::then.
+// Usage:
+//  auto startup = sequenceOf(initSerial())
+//    .then(initSensors())
+//    .then(calibrate())
+//    .then(readTemperature());   // Sequence<float>
+//  float t = startup.run();
+//  IO<float> io = startup.toIO();  // When a runtime IO is needed
+// Note:
+//  - Copies of a Sequence copy the effect array; build it once and keep it.
+
+#ifndef FUNCYCONTROLLERCPP_SEQUENCE_HPP
+#define FUNCYCONTROLLERCPP_SEQUENCE_HPP
+
+#include <cstddef>      // For size_t
+#include <utility>      // For std::move
+#include <vector>       // Effect array
+#include "IO.hpp"       // Effects
+
+namespace funcy_controller_cpp {
+
+template<typename T>
+class Sequence {
+public:
+  using value_type = T;
+  using Step = detail::ErasedFunction<void()>;
+
+  explicit Sequence(const IO<T>& first) : last(first.effect) {}
+
+  // Append next, the result of the current last effect is discarded
+  template<typename U>
+  Sequence<U> then(const IO<U>& next) const& {
+    Sequence<U> out(next);
+    out.steps.reserve(steps.size() + 1);
+    out.steps = steps;
+    out.steps.emplace_back(last);
+    return out;
+  }
+
+  template<typename U>
+  Sequence<U> then(const IO<U>& next) && {
+    Sequence<U> out(next);
+    out.steps = std::move(steps);
+    out.steps.emplace_back(std::move(last));
+    return out;
+  }
+
+  // Run all effects in order, return the result of the last one
+  T run() const {
+    for (const Step& step : steps) step();
+    return last();
+  }
+
+  // Runtime IO running this sequence (one closure around the loop)
+  IO<T> toIO() const {
+    return IO<T>([self = *this]() { return self.run(); });
+  }
+
+  size_t size() const { return steps.size() + 1; }
+
+  // Room for n effects in total (avoids reallocation while appending many)
+  void reserve(size_t n) {
+    if (n > 1) steps.reserve(n - 1);
+  }
+
+private:
+  template<typename> friend class Sequence;
+
+  std::vector<Step> steps;  // Effects before the last one, results discarded
+  detail::ErasedFunction<T()> last;
+};
+
+// Start a Sequence with first
+template<typename T>
+Sequence<T> sequenceOf(const IO<T>& first) {
+  return Sequence<T>(first);
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_SEQUENCE_HPP
@@ -0,0 +1,80 @@
+// ==================== StaticIO<Source, Stages> ====================
+// Concept:
+//  - An IO pipeline that is a constant: source and stages are function pointers or
+//    captureless lambdas, composed at compile time (same stages as Pipeline).
+//  - constexpr objects need no dynamic initialization before setup(): no constructor
+//    runs at startup, no std::function, no heap, and no static init order problems.
+//    They can live in read-only memory (flash).
+//  - run() executes the source, then all stages.
+// Usage:
+//  int readRaw() { return analogRead(A0); }
+//  constexpr auto temperature = staticIO(readRaw)
+//    .map([](int raw) { return raw * 0.0806f; })
+//    .map([](float mv) { return mv / 10.0f; });
+//  float t = temperature.run();
+//  IO<float> io = temperature.toIO();   // When a runtime IO is needed
+// Note:
+//  - Stages must be stateless (const-callable). Stateful stages: Pipeline or stage().
+//  - FUNCYCONTROLLERCPP_CONSTINIT expands to constinit in C++20 (empty otherwise),
+//    for mutable globals that still must be initialized at compile time.
+
+#ifndef FUNCYCONTROLLERCPP_STATICIO_HPP
+#define FUNCYCONTROLLERCPP_STATICIO_HPP
+
+#include <type_traits>  // For std::decay_t
+#include <utility>      // For std::move, std::declval
+#include "IO.hpp"       // toIO
+#include "Pipeline.hpp" // For the stage types
+
+#if defined(__cpp_constinit)
+#define FUNCYCONTROLLERCPP_CONSTINIT constinit
+#else
+#define FUNCYCONTROLLERCPP_CONSTINIT
+#endif
+
+namespace funcy_controller_cpp {
+
+template<typename Source, typename Stages = detail::IdentityStage>
+class StaticIO {
+public:
+  using value_type = std::decay_t<decltype(std::declval<const Stages&>()(std::declval<const Source&>()()))>;
+
+  constexpr explicit StaticIO(Source source, Stages stages = Stages())
+    : source(std::move(source)), stages(std::move(stages)) {}
+
+  value_type run() const { return stages(source()); }
+
+  // Runtime IO running this pipeline (copies the stateless stages into a std::function)
+  IO<value_type> toIO() const {
+    return IO<value_type>([self = *this]() { return self.run(); });
+  }
+
+  template<typename G>
+  constexpr StaticIO<Source, detail::MapStage<Stages, G>> map(G g) const {
+    return StaticIO<Source, detail::MapStage<Stages, G>>(source, {stages, std::move(g)});
+  }
+
+  template<typename G>
+  constexpr StaticIO<Source, detail::FlatMapStage<Stages, G>> flatMap(G g) const {
+    return StaticIO<Source, detail::FlatMapStage<Stages, G>>(source, {stages, std::move(g)});
+  }
+
+  template<typename G>
+  constexpr StaticIO<Source, detail::TapStage<Stages, G>> tap(G g) const {
+    return StaticIO<Source, detail::TapStage<Stages, G>>(source, {stages, std::move(g)});
+  }
+
+private:
+  Source source;
+  Stages stages;
+};
+
+// Start a StaticIO from a function pointer or captureless lambda
+template<typename Source>
+constexpr StaticIO<Source> staticIO(Source source) {
+  return StaticIO<Source>(source);
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_STATICIO_HPP
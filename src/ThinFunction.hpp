@@ -0,0 +1,192 @@
+// ==================== ThinFunction<R(Args...)> ====================
+// Concept:
+//  - Optional replacement for std::function inside IO, enabled by defining
+//    FUNCYCONTROLLERCPP_THIN_ERASURE for the whole build.
+//  - std::function generates a manager (clone / destroy / type info) plus an invoker
+//    for every lambda type. ThinFunction only generates the invoker (one small
+//    trampoline per lambda). Copying and destroying trivially copyable callables that
+//    fit the inline buffer is shared code, one per signature (memcpy, nothing to
+//    destroy). Most map / flatMap lambdas are of that kind.
+//  - Callables with non-trivial captures (String, IO, ...) or larger than the buffer
+//    still get a per-type manager, the large ones live on the heap like in std::function.
+// Note:
+//  - FUNCYCONTROLLERCPP_THIN_ERASURE_BUFFER sets the inline buffer size
+//    (default 4 pointers).
+//  - Only IO uses it (detail::ErasedFunction). Async keeps std::function.
+//  - Calling an empty ThinFunction (default-constructed, or built from a null function
+//    pointer) is fatal: FUNCYCONTROLLERCPP_THIN_ERASURE_EMPTY_CALL() runs (default
+//    std::terminate(), where std::function would throw std::bad_function_call).
+//    Define it to log or halt first; it must not return.
+
+#ifndef FUNCYCONTROLLERCPP_THINFUNCTION_HPP
+#define FUNCYCONTROLLERCPP_THINFUNCTION_HPP
+
+#include <cstddef>      // For size_t, max_align_t
+#include <cstring>      // For memcpy
+#include <exception>    // For std::terminate
+#include <functional>   // For std::function
+#include <new>          // For placement new
+#include <type_traits>  // For std::is_trivially_copyable, std::is_void, std::decay_t
+#include <utility>      // For std::forward, std::move
+
+#ifndef FUNCYCONTROLLERCPP_THIN_ERASURE_BUFFER
+#define FUNCYCONTROLLERCPP_THIN_ERASURE_BUFFER (4 * sizeof(void*))
+#endif
+
+#ifndef FUNCYCONTROLLERCPP_THIN_ERASURE_EMPTY_CALL
+#define FUNCYCONTROLLERCPP_THIN_ERASURE_EMPTY_CALL() std::terminate()
+#endif
+
+namespace funcy_controller_cpp {
+
+namespace detail {
+
+template<typename Sig> class ThinFunction;
+
+template<typename R, typename... Args>
+class ThinFunction<R(Args...)> {
+public:
+  ThinFunction() : storage() {}
+
+  template<typename F, typename D = std::decay_t<F>,
+           typename = std::enable_if_t<!std::is_same<D, ThinFunction>::value>,
+           typename = decltype(std::declval<D&>()(std::declval<Args>()...))>
+  ThinFunction(F&& f) {
+    if constexpr (std::is_pointer<std::remove_reference_t<F>>::value) {
+      if (f == nullptr) return;   // Null function pointer: stays empty
+    }
+    assign<D>(std::forward<F>(f), std::integral_constant<int, modeOf<D>()>());
+  }
+
+  ThinFunction(const ThinFunction& other) { copyFrom(other); }
+
+  ThinFunction& operator=(const ThinFunction& other) {
+    if (this != &other) {
+      reset();
+      copyFrom(other);
+    }
+    return *this;
+  }
+
+  ~ThinFunction() { reset(); }
+
+  R operator()(Args... args) const {
+    return invoker(storage, std::forward<Args>(args)...);
+  }
+
+  explicit operator bool() const { return invoker != &invokeEmpty; }
+
+private:
+  enum class Op { Copy, Destroy };
+  enum { Trivial = 0, Inline = 1, Heap = 2 };
+
+  using Invoker = R (*)(void*, Args&&...);
+  using Manager = void (*)(Op, void* dst, const void* src);
+
+  static constexpr size_t bufferSize = FUNCYCONTROLLERCPP_THIN_ERASURE_BUFFER;
+
+  alignas(std::max_align_t) mutable unsigned char storage[bufferSize];
+  Invoker invoker = &invokeEmpty;   // Never null: empty calls trap instead of jumping to 0
+  Manager manager = nullptr;   // nullptr: trivially copyable inline callable
+
+  template<typename D>
+  static constexpr int modeOf() {
+    return (sizeof(D) > bufferSize || alignof(D) > alignof(std::max_align_t)) ? Heap
+         : (std::is_trivially_copyable<D>::value && std::is_trivially_destructible<D>::value) ? Trivial
+         : Inline;
+  }
+
+  // ---------- Per callable type: only the invoker (and a manager if needed) ----------
+
+  // R = void discards the callable's result (like std::function)
+  template<typename D>
+  static R call(D& f, Args&&... args) {
+    if constexpr (std::is_void<R>::value) f(std::forward<Args>(args)...);
+    else return f(std::forward<Args>(args)...);
+  }
+
+  // Shared per signature: the invoker of an empty ThinFunction
+  static R invokeEmpty(void*, Args&&...) {
+    FUNCYCONTROLLERCPP_THIN_ERASURE_EMPTY_CALL();   // Does not return
+    std::terminate();
+  }
+
+  template<typename D>
+  static R invokeInline(void* s, Args&&... args) {
+    return call(*static_cast<D*>(s), std::forward<Args>(args)...);
+  }
+
+  template<typename D>
+  static R invokeHeap(void* s, Args&&... args) {
+    return call(**static_cast<D**>(s), std::forward<Args>(args)...);
+  }
+
+  template<typename D>
+  static void manageInline(Op op, void* dst, const void* src) {
+    if (op == Op::Copy) new (dst) D(*static_cast<const D*>(src));
+    else static_cast<D*>(dst)->~D();
+  }
+
+  template<typename D>
+  static void manageHeap(Op op, void* dst, const void* src) {
+    if (op == Op::Copy) *static_cast<D**>(dst) = new D(**static_cast<D* const*>(src));
+    else delete *static_cast<D**>(dst);
+  }
+
+  template<typename D, typename F>
+  void assign(F&& f, std::integral_constant<int, Trivial>) {
+    new (storage) D(std::forward<F>(f));
+    invoker = &invokeInline<D>;
+  }
+
+  template<typename D, typename F>
+  void assign(F&& f, std::integral_constant<int, Inline>) {
+    new (storage) D(std::forward<F>(f));
+    invoker = &invokeInline<D>;
+    manager = &manageInline<D>;
+  }
+
+  template<typename D, typename F>
+  void assign(F&& f, std::integral_constant<int, Heap>) {
+    *reinterpret_cast<D**>(storage) = new D(std::forward<F>(f));
+    invoker = &invokeHeap<D>;
+    manager = &manageHeap<D>;
+  }
+
+  // ---------- Shared per signature ----------
+
+  // The trivial path copies the whole buffer, including bytes the callable does not use
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+  void copyFrom(const ThinFunction& other) {
+    if (other.manager) other.manager(Op::Copy, storage, other.storage);
+    else memcpy(storage, other.storage, bufferSize);
+    invoker = other.invoker;
+    manager = other.manager;
+  }
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+  void reset() {
+    if (manager) manager(Op::Destroy, storage, nullptr);
+    invoker = &invokeEmpty;
+    manager = nullptr;
+  }
+};
+
+// The function wrapper IO stores its effects in
+#if defined(FUNCYCONTROLLERCPP_THIN_ERASURE)
+template<typename Sig> using ErasedFunction = ThinFunction<Sig>;
+#else
+template<typename Sig> using ErasedFunction = std::function<Sig>;
+#endif
+
+} // namespace detail
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_THINFUNCTION_HPP
@@ -0,0 +1,122 @@
+// ==================== ThreadPool (host only) ====================
+// Concept:
+//  - A fixed set of worker threads with one task queue, used to evaluate independent
+//    IO effects in parallel (zipParallel / mapNParallel in Zip.hpp).
+//  - A thread waiting for its tasks runs queued tasks itself instead of blocking,
+//    so parallel IO nested in a pool task cannot deadlock the pool.
+// Note:
+//  - Enabled on hosts (no ARDUINO define) with <thread> available. Targets with a
+//    std::thread implementation (e.g. ESP32) can define FUNCYCONTROLLERCPP_THREAD_POOL 1.
+//  - Effects run on worker threads: they must be thread safe (no shared Serial / state
+//    without locking).
+
+#ifndef FUNCYCONTROLLERCPP_THREADPOOL_HPP
+#define FUNCYCONTROLLERCPP_THREADPOOL_HPP
+
+#if !defined(FUNCYCONTROLLERCPP_THREAD_POOL)
+#if !defined(ARDUINO) && defined(__has_include)
+#if __has_include(<thread>)
+#define FUNCYCONTROLLERCPP_THREAD_POOL 1
+#endif
+#endif
+#endif
+
+#if defined(FUNCYCONTROLLERCPP_THREAD_POOL) && FUNCYCONTROLLERCPP_THREAD_POOL
+
+#include <condition_variable> // For std::condition_variable
+#include <cstddef>            // For size_t
+#include <deque>              // Task queue
+#include <functional>         // For std::function
+#include <mutex>              // For std::mutex
+#include <thread>             // For std::thread
+#include <utility>            // For std::move
+#include <vector>             // Workers
+
+namespace funcy_controller_cpp {
+
+class ThreadPool {
+public:
+  // Pending tasks of one caller, see run() / wait()
+  struct Group {
+    size_t pending = 0;
+  };
+
+  explicit ThreadPool(size_t threads = std::thread::hardware_concurrency()) {
+    if (threads == 0) threads = 1;
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+      workers.emplace_back([this]() { workerLoop(); });
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) worker.join();
+  }
+
+  size_t size() const { return workers.size(); }
+
+  // Queues task as part of group
+  void run(Group& group, std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++group.pending;
+      tasks.emplace_back([this, &group, task = std::move(task)]() {
+        task();
+        std::lock_guard<std::mutex> done(mutex);
+        --group.pending;
+        wake.notify_all();
+      });
+    }
+    wake.notify_all();
+  }
+
+  // Returns when all tasks of group are done, running queued tasks meanwhile
+  void wait(Group& group) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (group.pending > 0) {
+      if (tasks.empty()) {
+        wake.wait(lock);
+        continue;
+      }
+      std::function<void()> task = std::move(tasks.front());
+      tasks.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+
+private:
+  std::vector<std::thread> workers;
+  std::deque<std::function<void()>> tasks;
+  std::mutex mutex;
+  std::condition_variable wake;
+  bool stopping = false;
+
+  void workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      wake.wait(lock, [this]() { return stopping || !tasks.empty(); });
+      if (tasks.empty()) return;  // stopping, queue drained
+      std::function<void()> task = std::move(tasks.front());
+      tasks.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+};
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_THREAD_POOL
+
+#endif // FUNCYCONTROLLERCPP_THREADPOOL_HPP
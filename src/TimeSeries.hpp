@@ -0,0 +1,330 @@
+// ==================== Time-series compression ====================
+// Concept:
+//  - TimeSeriesEncoder<Bytes> packs (timestamp, value) samples into a fixed inline
+//    buffer of Bytes bytes, Gorilla style:
+//      timestamps: delta-of-delta, 1 bit for a regular sampling period
+//      values:     XOR with the previous float, 1 bit for an unchanged value,
+//                  otherwise only the meaningful (non-zero) bits
+//  - encoder(sample) returns Either<TimedSample, CompressionError>: Right(sample) if
+//    it was stored, Left(BufferFull) if not (the buffer stays valid), so it can be
+//    used as a map stage via stage().
+//  - TimeSeriesDecoder reads the samples back directly from the buffer (no copy).
+// Usage:
+//  TimeSeriesEncoder<1024> log;                  // global / static, not in loop()!
+//  readSample().map(stage(log)).run();           // Either<TimedSample, CompressionError>
+//  log.decoder().forEach([](TimedSample s) { upload(s); });
+// Note:
+//  - Quantized, slowly changing sensor values with a fixed period need a few bits
+//    per sample instead of 64. Noisy or smooth float data compresses much worse
+//    (2-5 bytes per sample, see examples/compression).
+
+#ifndef FUNCYCONTROLLERCPP_TIMESERIES_HPP
+#define FUNCYCONTROLLERCPP_TIMESERIES_HPP
+
+#include <cstddef>      // For size_t
+#include <cstdint>      // For uint8_t, uint32_t, uint64_t
+#include <cstring>      // For memcpy
+#include "Maybe.hpp"    // Decoder returns Maybe
+#include "Either.hpp"   // Encoder returns Either
+
+namespace funcy_controller_cpp {
+
+struct TimedSample {
+  uint32_t timestamp;   // e.g. millis()
+  float value;
+};
+
+enum class CompressionError : uint8_t {
+  BufferFull
+};
+
+namespace detail {
+
+inline unsigned countLeadingZeros32(uint32_t word) {
+#if defined(__GNUC__)
+  return __builtin_clz(word);
+#else
+  unsigned n = 0;
+  while (!(word & 0x80000000u)) { word <<= 1; ++n; }
+  return n;
+#endif
+}
+
+inline unsigned countTrailingZeros32(uint32_t word) {
+#if defined(__GNUC__)
+  return __builtin_ctz(word);
+#else
+  unsigned n = 0;
+  while (!(word & 1)) { word >>= 1; ++n; }
+  return n;
+#endif
+}
+
+inline uint32_t floatBits(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+inline float bitsToFloat(uint32_t bits) {
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// State shared by encoder and decoder: everything needed to predict the next sample
+struct TimeSeriesState {
+  uint32_t timestamp = 0;
+  uint32_t delta = 0;       // Modulo 2^32, so millis() wrap-around is a regular step
+  uint32_t bits = 0;        // Previous value as raw float bits
+  uint8_t leading = 0xFF;   // XOR window of the previous value (0xFF: none yet)
+  uint8_t trailing = 0;
+};
+
+// MSB-first bit writer on a caller-owned buffer
+class BitWriter {
+public:
+  BitWriter(uint8_t* data, size_t capacityBits) : data(data), capacityBits(capacityBits) {}
+
+  // Writes the lowest n bits of v (n <= 32), false if they do not fit
+  bool write(uint32_t v, unsigned n) {
+    if (pos + n > capacityBits) return false;
+    while (n > 0) {
+      const unsigned used = pos & 7;
+      const unsigned take = (8 - used < n) ? 8 - used : n;
+      const uint8_t chunk = uint8_t((v >> (n - take)) & ((1u << take) - 1));
+      if (used == 0) data[pos >> 3] = 0;
+      data[pos >> 3] |= uint8_t(chunk << (8 - used - take));
+      pos += take;
+      n -= take;
+    }
+    return true;
+  }
+
+  size_t position() const { return pos; }
+
+  // Rolls back to an earlier position and clears the bits after it
+  void rewind(size_t to) {
+    pos = to;
+    if (pos & 7) data[pos >> 3] &= uint8_t(0xFF << (8 - (pos & 7)));
+  }
+
+private:
+  uint8_t* data;
+  size_t capacityBits;
+  size_t pos = 0;
+};
+
+class BitReader {
+public:
+  BitReader(const uint8_t* data, size_t sizeBits) : data(data), sizeBits(sizeBits) {}
+
+  // Reads n bits (n <= 32), false if past the end
+  bool read(unsigned n, uint32_t& out) {
+    if (pos + n > sizeBits) return false;
+    uint32_t v = 0;
+    while (n > 0) {
+      const unsigned used = pos & 7;
+      const unsigned take = (8 - used < n) ? 8 - used : n;
+      const uint8_t chunk = uint8_t((data[pos >> 3] >> (8 - used - take)) & ((1u << take) - 1));
+      v = (v << take) | chunk;
+      pos += take;
+      n -= take;
+    }
+    out = v;
+    return true;
+  }
+
+private:
+  const uint8_t* data;
+  size_t sizeBits;
+  size_t pos = 0;
+};
+
+} // namespace detail
+
+// ==================== TimeSeriesDecoder ====================
+class TimeSeriesDecoder {
+public:
+  TimeSeriesDecoder(const uint8_t* data, size_t sizeBits, size_t count)
+    : reader(data, sizeBits), remainingSamples(count) {}
+
+  size_t remaining() const { return remainingSamples; }
+
+  // Next sample, Nothing at the end (or on a corrupt buffer)
+  Maybe<TimedSample> next() {
+    TimedSample sample{0, 0.0f};
+    if (remainingSamples == 0 || !decode(sample)) {
+      remainingSamples = 0;
+      return Maybe<TimedSample>::Nothing();
+    }
+    --remainingSamples;
+    ++decoded;
+    return Maybe<TimedSample>::Just(sample);
+  }
+
+  // Visits all remaining samples
+  template<typename F>
+  void forEach(F f) {
+    TimedSample sample{0, 0.0f};
+    while (remainingSamples > 0 && decode(sample)) {
+      --remainingSamples;
+      ++decoded;
+      f(sample);
+    }
+    remainingSamples = 0;
+  }
+
+private:
+  detail::BitReader reader;
+  detail::TimeSeriesState state;
+  size_t remainingSamples;
+  size_t decoded = 0;
+
+  bool decode(TimedSample& sample) {
+    uint32_t v = 0;
+    if (decoded == 0) {
+      if (!reader.read(32, state.timestamp) || !reader.read(32, state.bits)) return false;
+      sample = TimedSample{state.timestamp, detail::bitsToFloat(state.bits)};
+      return true;
+    }
+
+    // Timestamp: delta-of-delta prefix code 0 / 10 / 110 / 1110 / 1111
+    uint32_t dod = 0;
+    unsigned ones = 0;
+    while (ones < 4) {
+      if (!reader.read(1, v)) return false;
+      if (v == 0) break;
+      ++ones;
+    }
+    if (ones > 0) {
+      static const unsigned widths[] = {7, 9, 12, 32};
+      const unsigned width = widths[ones - 1];
+      if (!reader.read(width, v)) return false;
+      dod = (width == 32) ? v : v - ((1u << (width - 1)) - 1);
+    }
+    state.delta += dod;
+    state.timestamp += state.delta;
+
+    // Value: XOR with the previous one
+    if (!reader.read(1, v)) return false;
+    if (v == 1) {
+      if (!reader.read(1, v)) return false;
+      if (v == 1) {
+        uint32_t leading = 0, length = 0;
+        if (!reader.read(5, leading) || !reader.read(5, length)) return false;
+        state.leading = uint8_t(leading);
+        state.trailing = uint8_t(32 - leading - (length + 1));
+      }
+      const unsigned meaningful = 32 - state.leading - state.trailing;
+      if (meaningful == 0 || meaningful > 32 || !reader.read(meaningful, v)) return false;
+      state.bits ^= v << state.trailing;
+    }
+    sample = TimedSample{state.timestamp, detail::bitsToFloat(state.bits)};
+    return true;
+  }
+};
+
+// ==================== TimeSeriesEncoder<Bytes> ====================
+template<size_t Bytes>
+class TimeSeriesEncoder {
+public:
+  static_assert(Bytes >= 8, "TimeSeriesEncoder needs at least 8 bytes for the first sample");
+
+  using Result = Either<TimedSample, CompressionError>;
+
+  TimeSeriesEncoder() : writer(buffer, Bytes * 8) {}
+
+  // Copying would leave the writer pointing into the other buffer
+  TimeSeriesEncoder(const TimeSeriesEncoder&) = delete;
+  TimeSeriesEncoder& operator=(const TimeSeriesEncoder&) = delete;
+
+  Result operator()(TimedSample sample) {
+    const size_t mark = writer.position();
+    const detail::TimeSeriesState saved = state;
+    if (!encode(sample)) {
+      writer.rewind(mark);
+      state = saved;
+      return Result::Left(CompressionError::BufferFull);
+    }
+    ++samples;
+    return Result::Right(sample);
+  }
+
+  Result append(uint32_t timestamp, float value) { return (*this)(TimedSample{timestamp, value}); }
+
+  size_t count() const { return samples; }
+  size_t sizeBits() const { return writer.position(); }
+  size_t sizeBytes() const { return (writer.position() + 7) / 8; }
+  static constexpr size_t capacityBytes() { return Bytes; }
+  const uint8_t* data() const { return buffer; }
+
+  // Raw bytes (8 per sample) / compressed bytes
+  float compressionRatio() const {
+    return sizeBytes() == 0 ? 0.0f : float(samples * sizeof(TimedSample)) / float(sizeBytes());
+  }
+
+  TimeSeriesDecoder decoder() const { return TimeSeriesDecoder(buffer, writer.position(), samples); }
+
+  void clear() {
+    writer.rewind(0);
+    state = detail::TimeSeriesState();
+    samples = 0;
+  }
+
+private:
+  uint8_t buffer[Bytes] = {};
+  detail::BitWriter writer;
+  detail::TimeSeriesState state;
+  size_t samples = 0;
+
+  bool encode(TimedSample sample) {
+    const uint32_t bits = detail::floatBits(sample.value);
+    if (samples == 0) {
+      state.timestamp = sample.timestamp;
+      state.bits = bits;
+      return writer.write(sample.timestamp, 32) && writer.write(bits, 32);
+    }
+
+    // Timestamp
+    const uint32_t delta = sample.timestamp - state.timestamp;
+    const int32_t dod = int32_t(delta - state.delta);
+    bool ok;
+    if (dod == 0) {
+      ok = writer.write(0, 1);
+    } else if (dod >= -63 && dod <= 64) {
+      ok = writer.write(0x2, 2) && writer.write(uint32_t(dod + 63), 7);
+    } else if (dod >= -255 && dod <= 256) {
+      ok = writer.write(0x6, 3) && writer.write(uint32_t(dod + 255), 9);
+    } else if (dod >= -2047 && dod <= 2048) {
+      ok = writer.write(0xE, 4) && writer.write(uint32_t(dod + 2047), 12);
+    } else {
+      ok = writer.write(0xF, 4) && writer.write(uint32_t(dod), 32);
+    }
+    if (!ok) return false;
+    state.timestamp = sample.timestamp;
+    state.delta = delta;
+
+    // Value
+    const uint32_t x = bits ^ state.bits;
+    state.bits = bits;
+    if (x == 0) return writer.write(0, 1);
+
+    const unsigned leading = detail::countLeadingZeros32(x);
+    const unsigned trailing = detail::countTrailingZeros32(x);
+    if (state.leading != 0xFF && leading >= state.leading && trailing >= state.trailing) {
+      // Fits the previous window
+      const unsigned meaningful = 32 - state.leading - state.trailing;
+      return writer.write(0x2, 2) && writer.write(x >> state.trailing, meaningful);
+    }
+    const unsigned meaningful = 32 - leading - trailing;
+    state.leading = uint8_t(leading);
+    state.trailing = uint8_t(trailing);
+    return writer.write(0x3, 2) && writer.write(leading, 5) && writer.write(meaningful - 1, 5)
+        && writer.write(x >> trailing, meaningful);
+  }
+};
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_TIMESERIES_HPP
@@ -0,0 +1,170 @@
+// ==================== traverse / sequence for IO ====================
+// Concept:
+//  - Run one IO per element of a buffer in a flat loop: no flatMap chain whose
+//    depth grows with the buffer (no O(n) nested closures or stack frames).
+//      traverse(data, size, f)        f: A -> IO<B>, IO<std::vector<B>> (reserved once)
+//      traverse(data, size, f, out)   results into the caller's buffer, IO<size_t>
+//      sequence(ios, size[, out])     the same for a buffer of IO<T>
+//  - IOEither variants stop at the first Left:
+//      traverseIOEither(data, size, f, out)   f: A -> IO<Either<B, E>>
+//      sequenceIOEither(ios, size, out)       ios: IO<Either<T, E>>[]
+//    Result: IO<Either<size_t, E>>, Right(number of results) or the first Left.
+//    out is a B* (room for size results) or a std::vector<B>& (cleared, reserved).
+// Usage:
+//  int channels[] = {A0, A1, A2, A3};
+//  int raw[4];
+//  traverse(channels, 4, [](int pin) { return readAdc(pin); }, raw).run();
+// Note:
+//  - The buffers are read / written when the IO runs, they must outlive the IO.
+//  - std::vector overloads: the vector's size at run time is used. They keep a pointer
+//    to the vector, so temporaries are rejected (deleted rvalue overloads, as lazySeq).
+
+#ifndef FUNCYCONTROLLERCPP_TRAVERSE_HPP
+#define FUNCYCONTROLLERCPP_TRAVERSE_HPP
+
+#include <cstddef>      // For size_t
+#include <type_traits>  // For std::decay_t
+#include <utility>      // For std::declval
+#include <vector>       // Reserved result buffers
+#include "IO.hpp"       // Effects
+#include "Either.hpp"   // IOEither variants
+
+namespace funcy_controller_cpp {
+
+namespace detail {
+
+// B of f: A -> IO<B>
+template<typename F, typename A>
+using TraverseResult = typename std::decay_t<decltype(std::declval<F&>()(std::declval<const A&>()))>::value_type;
+
+template<typename A, typename F, typename B>
+void traverseInto(const A* data, size_t size, F& f, B* out) {
+  for (size_t i = 0; i < size; ++i) out[i] = f(data[i]).run();
+}
+
+template<typename A, typename F, typename B>
+void traverseInto(const A* data, size_t size, F& f, std::vector<B>& out) {
+  out.clear();
+  out.reserve(size);
+  for (size_t i = 0; i < size; ++i) out.push_back(f(data[i]).run());
+}
+
+template<typename A, typename F, typename B, typename E>
+Either<size_t, E> traverseEitherInto(const A* data, size_t size, F& f, B* out) {
+  for (size_t i = 0; i < size; ++i) {
+    Either<B, E> r = f(data[i]).run();
+    if (r.isLeft()) return Either<size_t, E>::Left(r.unwrapLeft());
+    out[i] = r.unwrapRight();
+  }
+  return Either<size_t, E>::Right(size);
+}
+
+template<typename A, typename F, typename B, typename E>
+Either<size_t, E> traverseEitherInto(const A* data, size_t size, F& f, std::vector<B>& out) {
+  out.clear();
+  out.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    Either<B, E> r = f(data[i]).run();
+    if (r.isLeft()) return Either<size_t, E>::Left(r.unwrapLeft());
+    out.push_back(r.unwrapRight());
+  }
+  return Either<size_t, E>::Right(size);
+}
+
+// sequence: traverse with the identity
+struct RunSelf {
+  template<typename IOT>
+  const IOT& operator()(const IOT& io) const { return io; }
+};
+
+} // namespace detail
+
+// ==================== traverse ====================
+
+// f: A -> IO<B>; results in a vector reserved for size elements
+template<typename A, typename F, typename B = detail::TraverseResult<F, A>>
+IO<std::vector<B>> traverse(const A* data, size_t size, F f) {
+  return IO<std::vector<B>>([=]() mutable {
+    std::vector<B> out;
+    detail::traverseInto(data, size, f, out);
+    return out;
+  });
+}
+
+// f: A -> IO<B>; results into out (room for size elements), returns size
+template<typename A, typename F, typename B>
+IO<size_t> traverse(const A* data, size_t size, F f, B* out) {
+  return IO<size_t>([=]() mutable {
+    detail::traverseInto(data, size, f, out);
+    return size;
+  });
+}
+
+template<typename A, typename F, typename B = detail::TraverseResult<F, A>>
+IO<std::vector<B>> traverse(const std::vector<A>& data, F f) {
+  const std::vector<A>* items = &data;
+  return IO<std::vector<B>>([=]() mutable {
+    std::vector<B> out;
+    detail::traverseInto(items->data(), items->size(), f, out);
+    return out;
+  });
+}
+
+// Temporary vectors would dangle: the IO runs after the full expression
+template<typename A, typename F>
+void traverse(const std::vector<A>&& data, F f) = delete;
+
+// ==================== sequence ====================
+
+template<typename T>
+IO<std::vector<T>> sequence(const IO<T>* ios, size_t size) {
+  return traverse(ios, size, detail::RunSelf());
+}
+
+template<typename T>
+IO<size_t> sequence(const IO<T>* ios, size_t size, T* out) {
+  return traverse(ios, size, detail::RunSelf(), out);
+}
+
+template<typename T>
+IO<std::vector<T>> sequence(const std::vector<IO<T>>& ios) {
+  return traverse(ios, detail::RunSelf());
+}
+
+template<typename T>
+void sequence(const std::vector<IO<T>>&& ios) = delete;
+
+// ==================== IOEither variants (stop at the first Left) ====================
+
+// f: A -> IO<Either<B, E>>; results into out (room for size elements)
+template<typename A, typename F, typename B,
+         typename E = typename detail::TraverseResult<F, A>::error_type>
+IO<Either<size_t, E>> traverseIOEither(const A* data, size_t size, F f, B* out) {
+  return IO<Either<size_t, E>>([=]() mutable {
+    return detail::traverseEitherInto<A, F, B, E>(data, size, f, out);
+  });
+}
+
+// f: A -> IO<Either<B, E>>; results into out (cleared, reserved for size elements)
+template<typename A, typename F, typename B,
+         typename E = typename detail::TraverseResult<F, A>::error_type>
+IO<Either<size_t, E>> traverseIOEither(const A* data, size_t size, F f, std::vector<B>& out) {
+  std::vector<B>* target = &out;
+  return IO<Either<size_t, E>>([=]() mutable {
+    return detail::traverseEitherInto<A, F, B, E>(data, size, f, *target);
+  });
+}
+
+template<typename T, typename E>
+IO<Either<size_t, E>> sequenceIOEither(const IO<Either<T, E>>* ios, size_t size, T* out) {
+  return traverseIOEither(ios, size, detail::RunSelf(), out);
+}
+
+template<typename T, typename E>
+IO<Either<size_t, E>> sequenceIOEither(const IO<Either<T, E>>* ios, size_t size, std::vector<T>& out) {
+  return traverseIOEither(ios, size, detail::RunSelf(), out);
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_TRAVERSE_HPP
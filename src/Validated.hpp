@@ -0,0 +1,174 @@
+// ==================== Validated<T, E, N> ====================
+// Concept:
+//  - Like Either<T, E>, but errors are accumulated instead of stopping at the first one.
+//  - Valid (holding a value) or Invalid (holding up to N errors).
+//  - Independent checks are combined with map2 / mapN (applicative style):
+//    the result is Valid only if all inputs are Valid, otherwise it carries
+//    the errors of ALL invalid inputs.
+//  - Errors live in an inline fixed-capacity buffer (ErrorBuffer<E, N>), no heap.
+//    Errors beyond N are counted (dropped()) but not stored.
+//  - Invalid(errors) with an empty ErrorBuffer is Nothing: an Invalid always
+//    carries at least one error, a Valid always a checked value.
+// Use cases:
+//  - Validating a device configuration and reporting every problem at once.
+
+#ifndef FUNCYCONTROLLERCPP_VALIDATED_HPP
+#define FUNCYCONTROLLERCPP_VALIDATED_HPP
+
+#include <cstddef>      // For size_t
+#include <type_traits>  // For std::decay_t
+#include <utility>      // For std::declval
+#include "Maybe.hpp"    // For Invalid(errors)
+#include "Either.hpp"   // For toEither()
+
+namespace funcy_controller_cpp {
+
+// ==================== ErrorBuffer<E, N> ====================
+template<typename E, size_t N>
+class ErrorBuffer {
+public:
+  static_assert(N > 0, "ErrorBuffer needs room for at least one error");
+
+  size_t size() const { return count_; }
+  bool empty() const { return count_ == 0 && dropped_ == 0; }
+  // Number of errors that did not fit into the buffer
+  size_t dropped() const { return dropped_; }
+  // All errors seen (stored + dropped)
+  size_t total() const { return count_ + dropped_; }
+
+  const E& operator[](size_t i) const { return errors_[i]; }
+  const E* begin() const { return errors_; }
+  const E* end() const { return errors_ + count_; }
+
+  void push(const E& error) {
+    if (count_ < N) errors_[count_++] = error;
+    else ++dropped_;
+  }
+
+  void append(const ErrorBuffer& other) {
+    for (size_t i = 0; i < other.count_; ++i) push(other.errors_[i]);
+    dropped_ += other.dropped_;
+  }
+
+private:
+  E errors_[N] = {};
+  size_t count_ = 0;
+  size_t dropped_ = 0;
+};
+
+// ==================== Validated<T, E, N> ====================
+template<typename T, typename E, size_t N>
+class Validated {
+public:
+  using value_type = T;
+  using error_type = E;
+  using Errors = ErrorBuffer<E, N>;
+
+  // Constructors
+  static Validated Valid(T value) {
+    return Validated(value, Errors());
+  }
+
+  static Validated Invalid(E error) {
+    Errors errors;
+    errors.push(error);
+    return Validated(T(), errors);
+  }
+
+  // Nothing if errors is empty (there is nothing to be Invalid about)
+  static Maybe<Validated> Invalid(const Errors& errors) {
+    if (errors.empty()) return Maybe<Validated>::Nothing();
+    return Maybe<Validated>::Just(fromErrors(errors));
+  }
+
+  // check: Valid(value) if ok, else Invalid(error)
+  static Validated check(T value, bool ok, E error) {
+    return ok ? Valid(value) : Invalid(error);
+  }
+
+  // Introspection
+  bool isValid() const { return errors_.empty(); }
+  bool isInvalid() const { return !errors_.empty(); }
+  const Errors& errors() const { return errors_; }
+
+  // Accessor (Use with caution, prefer match/fold)
+  T unwrapValid() const { return value; }
+
+  // map: transform the Valid value, Invalid passes its errors on
+  template<typename F>
+  auto map(F f) const {
+    using R = std::decay_t<decltype(f(value))>;
+    if (isValid()) return Validated<R, E, N>::Valid(f(value));
+    return Validated<R, E, N>::fromErrors(errors_);
+  }
+
+  // map2: combine with an independent Validated, errors of both are accumulated
+  template<typename U, typename F>
+  auto map2(const Validated<U, E, N>& other, F f) const {
+    using R = std::decay_t<decltype(f(value, other.unwrapValid()))>;
+    if (isValid() && other.isValid()) return Validated<R, E, N>::Valid(f(value, other.unwrapValid()));
+    Errors errors = errors_;
+    errors.append(other.errors());
+    return Validated<R, E, N>::fromErrors(errors);
+  }
+
+  // andThen (bind): dependent check, stops at the first Invalid like Either::flatMap
+  template<typename F>
+  auto andThen(F f) const {
+    using Ret = decltype(f(value));
+    if (isValid()) return f(value);
+    return Ret::fromErrors(errors_);
+  }
+
+  // match: pattern-match both sides
+  // onInvalid gets the ErrorBuffer, onValid the value
+  template<typename InvalidFn, typename ValidFn>
+  auto match(InvalidFn onInvalid, ValidFn onValid) const {
+    return isValid() ? onValid(value) : onInvalid(errors_);
+  }
+
+  // fold: convert to a value
+  template<typename InvalidFn, typename ValidFn>
+  auto fold(InvalidFn onInvalid, ValidFn onValid) const {
+    return isValid() ? onValid(value) : onInvalid(errors_);
+  }
+
+  // toEither: Right(value), or Left(first error)
+  Either<T, E> toEither() const {
+    if (isValid()) return Either<T, E>::Right(value);
+    return Either<T, E>::Left(errors_[0]);
+  }
+
+private:
+  template<typename, typename, size_t> friend class Validated;
+  template<typename F, typename E2, size_t N2, typename... Ts>
+  friend auto mapN(F f, const Validated<Ts, E2, N2>&... vs);
+  friend class Maybe<Validated>;   // Maybe<Validated>::Nothing() default-constructs
+
+  T value;
+  Errors errors_;
+
+  Validated() : value(), errors_() {}
+  Validated(T val, const Errors& errs)
+    : value(val), errors_(errs) {}
+
+  // Invalid from a buffer the caller knows is not empty
+  static Validated fromErrors(const Errors& errors) {
+    return Validated(T(), errors);
+  }
+};
+
+// mapN: combine any number of independent Validated values with f(T1, T2, ...)
+// Valid only if all are Valid, otherwise all errors (in argument order).
+template<typename F, typename E, size_t N, typename... Ts>
+auto mapN(F f, const Validated<Ts, E, N>&... vs) {
+  using R = std::decay_t<decltype(f(vs.unwrapValid()...))>;
+  if ((vs.isValid() && ...)) return Validated<R, E, N>::Valid(f(vs.unwrapValid()...));
+  ErrorBuffer<E, N> errors;
+  (errors.append(vs.errors()), ...);
+  return Validated<R, E, N>::fromErrors(errors);
+}
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_VALIDATED_HPP
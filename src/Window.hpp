@@ -0,0 +1,170 @@
+// ==================== Sliding-window statistics ====================
+// Concept:
+//  - Aggregators over the last N samples (N fixed at compile time), O(1) per sample:
+//      WindowMin<T, N> / WindowMax<T, N>  - monotonic deque, amortized O(1)
+//      WindowStats<T, N>                  - min, max, mean, variance in one pass
+//  - Mean and variance are updated incrementally (Welford add / replace),
+//    no recomputation over the window.
+//  - Like the streaming filters, they are used as map stages via stage():
+//      WindowStats<float, 64> stats;                // global / static, not in loop()!
+//      readSensor().map(stage(stats)).map([](WindowSummary<float> s) { ... });
+// Note:
+//  - Fewer than N samples seen: statistics cover what has been seen so far.
+//  - variance is the population variance (divided by count).
+//  - Mean and variance are accumulated and reported in Acc, a floating point type:
+//    float for integral T by default (WindowStats<int, N> over 1, 2, 1, 2 gives
+//    mean 1.5, variance 0.25), T itself for floating point T.
+//  - RAM: WindowStats stores N values plus 2 * N deque indices.
+
+#ifndef FUNCYCONTROLLERCPP_WINDOW_HPP
+#define FUNCYCONTROLLERCPP_WINDOW_HPP
+
+#include <cstddef>      // For size_t
+#include <type_traits>  // For std::conditional, std::is_floating_point
+#include "Filters.hpp"  // For stage()
+
+namespace funcy_controller_cpp {
+
+namespace detail {
+
+// Ring slots of the samples that can still become the window minimum (Better = less)
+// or maximum (Better = greater), best at the front. Values are read from the window ring.
+template<typename T, size_t N, typename Better>
+class MonotonicDeque {
+public:
+  // The caller has just written x to window[slot]
+  void push(const T* window, size_t slot, T x) {
+    // The front left the window when its slot got overwritten
+    if (size > 0 && slots[front] == slot) {
+      front = next(front);
+      --size;
+    }
+    while (size > 0 && !Better()(window[slots[at(size - 1)]], x)) --size;
+    slots[at(size)] = slot;
+    ++size;
+  }
+
+  T best(const T* window) const { return window[slots[front]]; }
+
+  void reset() { front = 0; size = 0; }
+
+private:
+  size_t slots[N] = {};
+  size_t front = 0;
+  size_t size = 0;
+
+  static size_t next(size_t i) { return (i + 1 == N) ? 0 : i + 1; }
+  size_t at(size_t offset) const { return (front + offset < N) ? front + offset : front + offset - N; }
+};
+
+struct Less {
+  template<typename T> bool operator()(const T& a, const T& b) const { return a < b; }
+};
+
+struct Greater {
+  template<typename T> bool operator()(const T& a, const T& b) const { return a > b; }
+};
+
+} // namespace detail
+
+// ==================== WindowMin / WindowMax ====================
+template<typename T, size_t N, typename Better>
+class WindowExtremum {
+public:
+  static_assert(N > 0, "Window needs at least 1 sample");
+
+  T operator()(T x) {
+    window[head] = x;
+    deque.push(window, head, x);
+    head = (head + 1 == N) ? 0 : head + 1;
+    return deque.best(window);
+  }
+
+  void reset() { head = 0; deque.reset(); }
+
+private:
+  T window[N] = {};
+  detail::MonotonicDeque<T, N, Better> deque;
+  size_t head = 0;
+};
+
+template<typename T, size_t N>
+using WindowMin = WindowExtremum<T, N, detail::Less>;
+
+template<typename T, size_t N>
+using WindowMax = WindowExtremum<T, N, detail::Greater>;
+
+// ==================== WindowStats<T, N> ====================
+namespace detail {
+
+template<typename T>
+using WindowAccumulator = typename std::conditional<std::is_floating_point<T>::value, T, float>::type;
+
+} // namespace detail
+
+template<typename T, typename Acc = detail::WindowAccumulator<T>>
+struct WindowSummary {
+  size_t count;
+  T min;
+  T max;
+  Acc mean;
+  Acc variance;
+};
+
+template<typename T, size_t N, typename Acc = detail::WindowAccumulator<T>>
+class WindowStats {
+public:
+  static_assert(N > 0, "Window needs at least 1 sample");
+  static_assert(std::is_floating_point<Acc>::value, "WindowStats: Acc must be a floating point type");
+
+  using Summary = WindowSummary<T, Acc>;
+
+  Summary operator()(T x) {
+    if (count < N) {
+      // Welford add
+      ++count;
+      const Acc delta = Acc(x) - mean;
+      mean += delta / Acc(count);
+      m2 += delta * (Acc(x) - mean);
+    } else {
+      // Welford replace: oldest sample out, x in
+      const Acc oldest = Acc(window[head]);
+      const Acc oldMean = mean;
+      mean += (Acc(x) - oldest) / Acc(N);
+      m2 += (Acc(x) - oldest) * (Acc(x) - mean + oldest - oldMean);
+      if (m2 < Acc(0)) m2 = Acc(0);  // Rounding
+    }
+    window[head] = x;
+    minimum.push(window, head, x);
+    maximum.push(window, head, x);
+    head = (head + 1 == N) ? 0 : head + 1;
+    return summary();
+  }
+
+  Summary summary() const {
+    if (count == 0) return Summary{0, T(), T(), Acc(), Acc()};
+    return Summary{count, minimum.best(window), maximum.best(window), mean, m2 / Acc(count)};
+  }
+
+  void reset() {
+    head = 0;
+    count = 0;
+    mean = Acc();
+    m2 = Acc();
+    minimum.reset();
+    maximum.reset();
+  }
+
+private:
+  T window[N] = {};
+  detail::MonotonicDeque<T, N, detail::Less> minimum;
+  detail::MonotonicDeque<T, N, detail::Greater> maximum;
+  size_t head = 0;
+  size_t count = 0;
+  Acc mean = Acc();
+  Acc m2 = Acc();   // Sum of squared differences from the mean
+};
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_WINDOW_HPP
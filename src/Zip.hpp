@@ -0,0 +1,93 @@
+// ==================== zip / mapN for IO ====================
+// Concept:
+//  - Applicative combination of independent IO effects: one flat effect that runs
+//    all arguments (left to right) and returns their results together, instead of
+//    nested flatMap closures.
+//      zip(io1, io2, ...)      IO<std::tuple<T1, T2, ...>>
+//      mapN(f, io1, io2, ...)  IO<R>, R = f(T1, T2, ...)
+//  - Host builds (ThreadPool.hpp) can evaluate the arguments in parallel:
+//      zipParallel(pool, io1, io2, ...), mapNParallel(pool, f, io1, io2, ...)
+//    The first argument runs on the calling thread, the others on the pool.
+// Usage:
+//  auto climate = mapN([](float t, float h) { return dewPoint(t, h); },
+//                      readTemperature(), readHumidity());
+//  float dp = climate.run();
+// Note:
+//  - Only for effects that do not depend on each other; use flatMap otherwise.
+//  - The parallel variants keep a reference to the pool: it must outlive the IO.
+
+#ifndef FUNCYCONTROLLERCPP_ZIP_HPP
+#define FUNCYCONTROLLERCPP_ZIP_HPP
+
+#include <tuple>          // For std::tuple, std::apply
+#include <type_traits>    // For std::decay_t
+#include <utility>        // For std::index_sequence, std::move
+#include "IO.hpp"         // Zipped effects
+#include "ThreadPool.hpp" // Parallel variants (host only)
+
+#if defined(FUNCYCONTROLLERCPP_THREAD_POOL) && FUNCYCONTROLLERCPP_THREAD_POOL
+#include <optional>       // Result slots of the parallel variants
+#endif
+
+namespace funcy_controller_cpp {
+
+// zip: run all effects (left to right), results as a tuple
+template<typename... Ts>
+IO<std::tuple<Ts...>> zip(const IO<Ts>&... ios) {
+  static_assert(sizeof...(Ts) > 0, "zip needs at least one IO");
+  return IO<std::tuple<Ts...>>([ios...]() {
+    return std::tuple<Ts...>{ios.run()...};  // Braced init: evaluated in order
+  });
+}
+
+// mapN: run all effects (left to right), combine the results with f(T1, T2, ...)
+template<typename F, typename... Ts>
+auto mapN(F f, const IO<Ts>&... ios) {
+  static_assert(sizeof...(Ts) > 0, "mapN needs at least one IO");
+  using R = std::decay_t<decltype(f(std::declval<Ts>()...))>;
+  return IO<R>([f, ios...]() {
+    return std::apply(f, std::tuple<Ts...>{ios.run()...});
+  });
+}
+
+#if defined(FUNCYCONTROLLERCPP_THREAD_POOL) && FUNCYCONTROLLERCPP_THREAD_POOL
+
+namespace detail {
+
+template<typename... Ts, size_t... Is>
+std::tuple<Ts...> runParallel(ThreadPool& pool, const std::tuple<IO<Ts>...>& ios, std::index_sequence<Is...>) {
+  std::tuple<std::optional<Ts>...> results;
+  ThreadPool::Group group;
+  // Arguments 1..n-1 on the pool, argument 0 here
+  ((Is == 0 ? void() : pool.run(group, [&]() { std::get<Is>(results).emplace(std::get<Is>(ios).run()); })), ...);
+  std::get<0>(results).emplace(std::get<0>(ios).run());
+  pool.wait(group);
+  return std::tuple<Ts...>{std::move(*std::get<Is>(results))...};
+}
+
+} // namespace detail
+
+// zipParallel: like zip, the effects run concurrently on pool
+template<typename... Ts>
+IO<std::tuple<Ts...>> zipParallel(ThreadPool& pool, const IO<Ts>&... ios) {
+  static_assert(sizeof...(Ts) > 0, "zipParallel needs at least one IO");
+  return IO<std::tuple<Ts...>>([&pool, all = std::tuple<IO<Ts>...>(ios...)]() {
+    return detail::runParallel<Ts...>(pool, all, std::index_sequence_for<Ts...>());
+  });
+}
+
+// mapNParallel: like mapN, the effects run concurrently on pool
+template<typename F, typename... Ts>
+auto mapNParallel(ThreadPool& pool, F f, const IO<Ts>&... ios) {
+  static_assert(sizeof...(Ts) > 0, "mapNParallel needs at least one IO");
+  using R = std::decay_t<decltype(f(std::declval<Ts>()...))>;
+  return IO<R>([&pool, f, all = std::tuple<IO<Ts>...>(ios...)]() {
+    return std::apply(f, detail::runParallel<Ts...>(pool, all, std::index_sequence_for<Ts...>()));
+  });
+}
+
+#endif // FUNCYCONTROLLERCPP_THREAD_POOL
+
+} // namespace funcy_controller_cpp
+
+#endif // FUNCYCONTROLLERCPP_ZIP_HPP